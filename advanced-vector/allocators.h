@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "vector.h"
+
+// Аллокатор с гарантированным выравниванием буфера: SIMD-ядра (AVX-512 и
+// т.п.) могут рассчитывать на выровненный begin() без скалярных прологов.
+// Аллокатор переезжает вместе с буфером, поэтому выравнивание сохраняется
+// и после реаллокаций роста
+template<typename T, size_t Alignment>
+struct AlignedAllocator {
+    static_assert((Alignment & (Alignment - 1)) == 0,
+                  "Выравнивание должно быть степенью двойки");
+    static_assert(Alignment >= alignof(T),
+                  "Выравнивание не может быть слабее естественного");
+
+    T *Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        return static_cast<T *>(
+                operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void Deallocate(T *buf, size_t /*n*/) noexcept {
+        operator delete(buf, std::align_val_t{Alignment});
+    }
+};
+
+// Vector с буфером, выровненным на Alignment байт
+template<typename T, size_t Alignment>
+using AlignedVector = Vector<T, AlignedAllocator<T, Alignment>>;
+
+// Аллокатор для векторов, обёрнутых вокруг чужой памяти через
+// Vector::Adopt: усыновлённый буфер освобождается пользовательским
+// деструктором, а буферы, выделенные при последующем росте, — обычным
+// образом
+template<typename T>
+class AdoptingAllocator {
+public:
+    using Deleter = void (*)(T *buffer, size_t capacity);
+
+    AdoptingAllocator() = default;
+
+    AdoptingAllocator(T *adopted, Deleter deleter)
+            : adopted_(adopted), deleter_(deleter) {}
+
+    T *Allocate(size_t n) {
+        // Рост пересадил содержимое в наш собственный буфер — эта копия
+        // аллокатора усыновлённой памятью больше не управляет
+        adopted_ = nullptr;
+        return DefaultAllocator<T>{}.Allocate(n);
+    }
+
+    void Deallocate(T *buf, size_t n) noexcept {
+        if (buf != nullptr && buf == adopted_) {
+            if (deleter_ != nullptr) {
+                deleter_(buf, n);
+            }
+            return;
+        }
+        DefaultAllocator<T>{}.Deallocate(buf, n);
+    }
+
+private:
+    T *adopted_ = nullptr;
+    Deleter deleter_ = nullptr;
+};
+
+template<typename T>
+using AdoptedVector = Vector<T, AdoptingAllocator<T>>;
+
+// Оборачивает готовый буфер в AdoptedVector без копирования элементов
+template<typename T>
+AdoptedVector<T> AdoptBuffer(T *buffer, size_t size, size_t capacity,
+                             typename AdoptingAllocator<T>::Deleter deleter) {
+    return AdoptedVector<T>::Adopt(buffer, size, capacity,
+                                   AdoptingAllocator<T>(buffer, deleter));
+}
+
+// Монотонная арена: выдаёт память сдвигом указателя по заранее выделенному
+// блоку и освобождает всё разом в деструкторе или через Reset().
+// Память отдельных аллокаций не возвращается — это осознанная плата за
+// O(1) выделение и освобождение короткоживущих контейнеров
+class MonotonicArena {
+public:
+    explicit MonotonicArena(size_t capacity_bytes)
+            : begin_(static_cast<std::byte *>(operator new(capacity_bytes))),
+              current_(begin_), end_(begin_ + capacity_bytes) {}
+
+    ~MonotonicArena() { operator delete(begin_); }
+
+    MonotonicArena(const MonotonicArena &) = delete;
+
+    MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+    void *Allocate(size_t bytes, size_t alignment) {
+        auto address = reinterpret_cast<uintptr_t>(current_);
+        uintptr_t aligned = (address + alignment - 1) & ~(alignment - 1);
+        std::byte *result = begin_ + (aligned - reinterpret_cast<uintptr_t>(begin_));
+        if (result + bytes > end_) {
+            throw std::bad_alloc();
+        }
+        current_ = result + bytes;
+        return result;
+    }
+
+    // Возвращает арену в исходное состояние, делая всю выданную память
+    // доступной для повторного использования
+    void Reset() noexcept { current_ = begin_; }
+
+    size_t UsedBytes() const noexcept {
+        return static_cast<size_t>(current_ - begin_);
+    }
+
+private:
+    std::byte *begin_;
+    std::byte *current_;
+    std::byte *end_;
+};
+
+// Аллокатор для RawMemory/Vector поверх MonotonicArena. Deallocate — no-op:
+// память живёт, пока жива арена
+template<typename T>
+class ArenaAllocator {
+public:
+    explicit ArenaAllocator(MonotonicArena &arena) : arena_(&arena) {}
+
+    T *Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        return static_cast<T *>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void Deallocate(T * /*buf*/, size_t /*n*/) noexcept {}
+
+private:
+    MonotonicArena *arena_;
+};
+
+// Пул со свободными списками в thread-local хранилище: блоки округляются
+// до степени двойки и после Deallocate переиспользуются без обращения к
+// глобальной куче (и её блокировке)
+template<typename T>
+class PoolAllocator {
+public:
+    T *Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        size_t bucket = Bucket(n);
+        FreeLists &lists = ThreadLists();
+        if (void *block = lists.heads[bucket]) {
+            lists.heads[bucket] = *static_cast<void **>(block);
+            return static_cast<T *>(block);
+        }
+        return static_cast<T *>(operator new(BucketBytes(bucket)));
+    }
+
+    void Deallocate(T *buf, size_t n) noexcept {
+        if (buf == nullptr) {
+            return;
+        }
+        FreeLists &lists = ThreadLists();
+        *reinterpret_cast<void **>(buf) = lists.heads[Bucket(n)];
+        lists.heads[Bucket(n)] = buf;
+    }
+
+private:
+    static constexpr size_t NUM_BUCKETS = 48;
+
+    struct FreeLists {
+        void *heads[NUM_BUCKETS] = {};
+
+        ~FreeLists() {
+            for (void *head: heads) {
+                while (head != nullptr) {
+                    void *next = *static_cast<void **>(head);
+                    operator delete(head);
+                    head = next;
+                }
+            }
+        }
+    };
+
+    static FreeLists &ThreadLists() {
+        thread_local FreeLists lists;
+        return lists;
+    }
+
+    // Номер корзины — позиция старшего бита размера, округлённого вверх до
+    // степени двойки; минимальный блок должен вмещать указатель списка
+    static size_t Bucket(size_t n) {
+        size_t bytes = n * sizeof(T);
+        if (bytes < sizeof(void *)) {
+            bytes = sizeof(void *);
+        }
+        size_t bucket = 0;
+        while ((size_t{1} << bucket) < bytes) {
+            ++bucket;
+        }
+        assert(bucket < NUM_BUCKETS);
+        return bucket;
+    }
+
+    static size_t BucketBytes(size_t bucket) { return size_t{1} << bucket; }
+};
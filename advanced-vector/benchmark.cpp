@@ -0,0 +1,217 @@
+// Бенчмарки горячих путей Vector против std::vector.
+// Отдельный исполняемый файл:
+//   g++ -std=c++20 -O2 -DNDEBUG benchmark.cpp -o benchmark && ./benchmark
+// Каждый замер повторяется несколько раз, печатается лучшее время —
+// так результат меньше шумит от прогрева кучи и планировщика
+
+#include "vector.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int NUM_REPETITIONS = 5;
+
+// Тип с nothrow-move: при реаллокации Vector обязан перемещать
+    struct Movable {
+        Movable() = default;
+
+        explicit Movable(int id) : id(id) {}
+
+        Movable(const Movable &) = default;
+
+        Movable(Movable &&other) noexcept : id(other.id), name(std::move(other.name)) {}
+
+        Movable &operator=(const Movable &) = default;
+
+        Movable &operator=(Movable &&) noexcept = default;
+
+        int id = 0;
+        std::string name;
+    };
+
+// Тип без noexcept-перемещения: при реаллокации Vector обязан копировать
+    struct CopyOnly {
+        CopyOnly() = default;
+
+        explicit CopyOnly(int id) : id(id) {}
+
+        CopyOnly(const CopyOnly &) = default;
+
+        CopyOnly(CopyOnly &&other) : id(other.id) {}
+
+        CopyOnly &operator=(const CopyOnly &) = default;
+
+        int id = 0;
+    };
+
+// Запускает op несколько раз и возвращает лучшее время в миллисекундах
+    template<typename Op>
+    double MeasureMs(Op op) {
+        double best = 1e300;
+        for (int i = 0; i < NUM_REPETITIONS; ++i) {
+            const auto start = Clock::now();
+            op();
+            const auto finish = Clock::now();
+            const double ms =
+                    std::chrono::duration<double, std::milli>(finish - start).count();
+            best = std::min(best, ms);
+        }
+        return best;
+    }
+
+    void Report(const std::string &name, double ours_ms, double std_ms) {
+        std::cout << name << ": Vector " << ours_ms << " ms, std::vector "
+                  << std_ms << " ms (x" << std_ms / ours_ms << ")" << std::endl;
+    }
+
+// Сумма, видимая компилятору, чтобы замеряемый код не был выброшен
+    volatile long long sink = 0;
+
+    template<typename V, typename T>
+    void PushBackGrowth(size_t count) {
+        V v;
+        for (size_t i = 0; i < count; ++i) {
+            v.push_back(T(static_cast<int>(i)));
+        }
+        sink = sink + static_cast<long long>(v.size());
+    }
+
+    template<typename T>
+    void PushBackGrowthOurs(size_t count) {
+        Vector<T> v;
+        for (size_t i = 0; i < count; ++i) {
+            v.PushBack(T(static_cast<int>(i)));
+        }
+        sink = sink + static_cast<long long>(v.Size());
+    }
+
+    template<typename T>
+    void BenchPushBack(const std::string &name, size_t count) {
+        const double ours = MeasureMs([&] { PushBackGrowthOurs<T>(count); });
+        const double stds = MeasureMs([&] { PushBackGrowth<std::vector<T>, T>(count); });
+        Report("PushBack growth, " + name, ours, stds);
+    }
+
+    void BenchInsertMiddle(size_t count) {
+        const double ours = MeasureMs([&] {
+            Vector<int> v;
+            v.Reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                v.Insert(v.cbegin() + v.Size() / 2, static_cast<int>(i));
+            }
+            sink = sink + v[0];
+        });
+        const double stds = MeasureMs([&] {
+            std::vector<int> v;
+            v.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                v.insert(v.begin() + v.size() / 2, static_cast<int>(i));
+            }
+            sink = sink + v[0];
+        });
+        Report("Insert middle", ours, stds);
+    }
+
+    void BenchErase(size_t count) {
+        const double ours = MeasureMs([&] {
+            Vector<int> v;
+            for (size_t i = 0; i < count; ++i) {
+                v.PushBack(static_cast<int>(i));
+            }
+            while (v.Size() > 0) {
+                v.Erase(v.cbegin());
+            }
+        });
+        const double stds = MeasureMs([&] {
+            std::vector<int> v;
+            for (size_t i = 0; i < count; ++i) {
+                v.push_back(static_cast<int>(i));
+            }
+            while (!v.empty()) {
+                v.erase(v.begin());
+            }
+        });
+        Report("Erase front (full drain)", ours, stds);
+    }
+
+    void BenchCopyAssignReuse(size_t count) {
+        Vector<Movable> src(count);
+        Vector<Movable> dst(count);
+        std::vector<Movable> std_src(count);
+        std::vector<Movable> std_dst(count);
+        const double ours = MeasureMs([&] {
+            dst = src;
+            sink = sink + static_cast<long long>(dst.Size());
+        });
+        const double stds = MeasureMs([&] {
+            std_dst = std_src;
+            sink = sink + static_cast<long long>(std_dst.size());
+        });
+        Report("Copy assignment with capacity reuse", ours, stds);
+    }
+
+    // Цена проверки границ в At(): та же свёртка через operator[] (в этой
+    // сборке без assert из-за NDEBUG) и через At() с trap-веткой
+    void BenchCheckedIndexing(size_t count) {
+        Vector<uint64_t> v(count);
+        for (size_t i = 0; i < count; ++i) {
+            v[i] = i;
+        }
+        const double unchecked = MeasureMs([&] {
+            long long total = 0;
+            for (size_t i = 0; i < count; ++i) {
+                total += static_cast<long long>(v[i]);
+            }
+            sink = sink + total;
+        });
+        const double checked = MeasureMs([&] {
+            long long total = 0;
+            for (size_t i = 0; i < count; ++i) {
+                total += static_cast<long long>(v.At(i));
+            }
+            sink = sink + total;
+        });
+        std::cout << "Indexed sum: operator[] " << unchecked << " ms, At() "
+                  << checked << " ms (x" << checked / unchecked << ")"
+                  << std::endl;
+    }
+
+    void BenchResize(size_t count) {
+        const double ours = MeasureMs([&] {
+            Vector<uint64_t> v;
+            v.Resize(count);
+            v.Resize(count / 2);
+            v.Resize(count);
+            sink = sink + static_cast<long long>(v[count - 1]);
+        });
+        const double stds = MeasureMs([&] {
+            std::vector<uint64_t> v;
+            v.resize(count);
+            v.resize(count / 2);
+            v.resize(count);
+            sink = sink + static_cast<long long>(v[count - 1]);
+        });
+        Report("Resize grow/shrink/grow", ours, stds);
+    }
+
+} // namespace
+
+int main() {
+    const size_t LARGE = 4'000'000;
+    const size_t MEDIUM = 40'000;
+
+    BenchPushBack<uint64_t>("trivial uint64_t", LARGE);
+    BenchPushBack<Movable>("nothrow-movable", LARGE / 4);
+    BenchPushBack<CopyOnly>("copy-only", LARGE / 4);
+    BenchInsertMiddle(MEDIUM);
+    BenchErase(MEDIUM);
+    BenchCopyAssignReuse(LARGE / 4);
+    BenchResize(LARGE);
+    BenchCheckedIndexing(LARGE);
+}
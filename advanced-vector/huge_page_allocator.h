@@ -0,0 +1,108 @@
+#pragma once
+
+#include "vector.h"
+
+#include <new>
+
+#include <sys/mman.h>
+
+#if __has_include(<numaif.h>)
+
+#include <numaif.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#endif
+
+// Аллокатор для больших сканируемых таблиц: буфер берётся напрямую у ядра
+// через mmap, и региону советуются прозрачные большие страницы
+// (madvise(MADV_HUGEPAGE)) — на многогигабайтных буферах это снимает
+// основную часть промахов dTLB. Дополнительно задаётся NUMA-политика
+// размещения страниц: по умолчанию first-touch кладёт страницы на узел
+// конструктора, что для читаемых со всех сокетов таблиц означает
+// перекос трафика. Аллокатор переезжает вместе с RawMemory, поэтому
+// политика сохраняется при реаллокациях роста
+
+// Политика привязки страниц к NUMA-узлам. FirstTouch — поведение ядра по
+// умолчанию; Interleave чередует страницы по всем узлам, выравнивая
+// пропускную способность для общих таблиц; Bind прижимает буфер к
+// конкретному узлу рядом с потребителем
+enum class NumaPlacement {
+    FirstTouch,
+    Interleave,
+    Bind,
+};
+
+template<typename T>
+class HugePageAllocator {
+public:
+    HugePageAllocator() = default;
+
+    explicit HugePageAllocator(NumaPlacement placement, int node = 0)
+            : placement_(placement), node_(node) {}
+
+    T *Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        size_t bytes = RoundUpToHugePage(n * sizeof(T));
+        void *base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        // Советы ядру best-effort: без поддержки THP или NUMA буфер просто
+        // остаётся на обычных страницах с first-touch размещением
+        ::madvise(base, bytes, MADV_HUGEPAGE);
+        ApplyPlacement(base, bytes);
+        return static_cast<T *>(base);
+    }
+
+    void Deallocate(T *buf, size_t n) noexcept {
+        if (buf != nullptr) {
+            ::munmap(buf, RoundUpToHugePage(n * sizeof(T)));
+        }
+    }
+
+private:
+    // Размер x86-64 huge page; округление длины региона позволяет ядру
+    // выдать большие страницы на всю его протяжённость
+    static constexpr size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+
+    static size_t RoundUpToHugePage(size_t bytes) {
+        return (bytes + HUGE_PAGE_BYTES - 1) & ~(HUGE_PAGE_BYTES - 1);
+    }
+
+    void ApplyPlacement(void *base, size_t bytes) const noexcept {
+#if __has_include(<numaif.h>) && defined(SYS_mbind)
+        // mbind зовётся через syscall: обёртка из libnuma потребовала бы
+        // линковки с -lnuma ради одного вызова
+        unsigned long mask = ~0ul;
+        switch (placement_) {
+            case NumaPlacement::Interleave:
+                ::syscall(SYS_mbind, base, bytes, MPOL_INTERLEAVE, &mask,
+                          sizeof(mask) * 8, 0);
+                break;
+            case NumaPlacement::Bind:
+                mask = 1ul << node_;
+                ::syscall(SYS_mbind, base, bytes, MPOL_BIND, &mask,
+                          sizeof(mask) * 8, 0);
+                break;
+            case NumaPlacement::FirstTouch:
+                break;
+        }
+#else
+        (void) base;
+        (void) bytes;
+#endif
+    }
+
+    NumaPlacement placement_ = NumaPlacement::FirstTouch;
+    int node_ = 0;
+};
+
+// Vector поверх больших страниц; политика NUMA задаётся аллокатором в
+// конструкторе:
+//   HugePageVector<Row> v(HugePageAllocator<Row>(NumaPlacement::Bind, 1));
+template<typename T>
+using HugePageVector = Vector<T, HugePageAllocator<T>>;
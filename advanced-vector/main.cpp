@@ -1,6 +1,25 @@
+#define ADVANCED_VECTOR_STATS
+
+#include "allocators.h"
+#include "huge_page_allocator.h"
+#include "mmap_vector.h"
+#include "ring_vector.h"
+#include "segmented_vector.h"
+#include "shared_vector.h"
+#include "small_vector.h"
+#include "soa_vector.h"
+#include "sorted_vector.h"
 #include "vector.h"
+#include "vector_algorithms.h"
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -560,6 +579,1679 @@ void Test6() {
     }
 }
 
+void Test7() {
+    const size_t SIZE = 100'000;
+    {
+        // Тривиально копируемые типы растут через realloc/memcpy —
+        // содержимое и ёмкость должны вести себя как раньше
+        Vector<int> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(static_cast<int>(i));
+        }
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() >= SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            assert(v[i] == static_cast<int>(i));
+        }
+    }
+    {
+        // PushBack собственного элемента безопасен и на realloc-пути
+        Vector<int> v;
+        v.PushBack(42);
+        assert(v.Size() == v.Capacity());
+        v.PushBack(v[0]);
+        assert(v[0] == 42);
+        assert(v[1] == 42);
+    }
+    {
+        struct Packed {
+            uint64_t id;
+            uint32_t flags;
+        };
+        static_assert(std::is_trivially_copyable_v<Packed>);
+        Vector<Packed> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(Packed{i, static_cast<uint32_t>(i % 7)});
+        }
+        v.Reserve(SIZE * 4);
+        assert(v.Capacity() == SIZE * 4);
+        for (size_t i = 0; i < SIZE; ++i) {
+            assert(v[i].id == i);
+            assert(v[i].flags == i % 7);
+        }
+    }
+}
+
+void Test8() {
+    const size_t SIZE = 1'000;
+    {
+        // Вектор целиком живёт в арене: рост и освобождение не трогают кучу
+        MonotonicArena arena(1 << 20);
+        Vector<int, ArenaAllocator<int>> v{ArenaAllocator<int>(arena)};
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(static_cast<int>(i));
+        }
+        assert(v.Size() == SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            assert(v[i] == static_cast<int>(i));
+        }
+        assert(arena.UsedBytes() >= SIZE * sizeof(int));
+
+        auto v_copy(v);
+        assert(v_copy.Size() == SIZE);
+        assert(v_copy[SIZE - 1] == static_cast<int>(SIZE - 1));
+    }
+    {
+        // Нетривиальные типы в арене: деструкторы элементов всё ещё вызываются
+        Obj::ResetCounters();
+        MonotonicArena arena(1 << 20);
+        {
+            Vector<Obj, ArenaAllocator<Obj>> v(SIZE / 10,
+                                               ArenaAllocator<Obj>(arena));
+            assert(Obj::GetAliveObjectCount() == SIZE / 10);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        // Пул переиспользует освобождённый блок того же класса размера
+        PoolAllocator<int> pool;
+        int *first = pool.Allocate(100);
+        pool.Deallocate(first, 100);
+        int *second = pool.Allocate(100);
+        assert(first == second);
+        pool.Deallocate(second, 100);
+
+        Vector<int, PoolAllocator<int>> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(static_cast<int>(i));
+        }
+        assert(v.Size() == SIZE);
+        assert(v[SIZE - 1] == static_cast<int>(SIZE - 1));
+    }
+}
+
+void Test9() {
+    const size_t INLINE = 4;
+    {
+        // Пока элементов не больше InlineCapacity, куча не используется
+        SmallVector<int, INLINE> v;
+        assert(v.IsInline());
+        assert(v.Capacity() == INLINE);
+        for (size_t i = 0; i < INLINE; ++i) {
+            v.PushBack(static_cast<int>(i));
+        }
+        assert(v.IsInline());
+        assert(v.Size() == INLINE);
+
+        // Переполнение переводит содержимое в RawMemory
+        v.PushBack(42);
+        assert(!v.IsInline());
+        assert(v.Size() == INLINE + 1);
+        assert(v.Capacity() == INLINE * 2);
+        for (size_t i = 0; i < INLINE; ++i) {
+            assert(v[i] == static_cast<int>(i));
+        }
+        assert(v[INLINE] == 42);
+    }
+    {
+        Obj::ResetCounters();
+        {
+            SmallVector<Obj, INLINE> v;
+            v.EmplaceBack(1);
+            v.EmplaceBack(2);
+            assert(v.IsInline());
+            assert(Obj::GetAliveObjectCount() == 2);
+
+            SmallVector<Obj, INLINE> v_moved(std::move(v));
+            assert(v_moved.Size() == 2);
+            assert(v_moved[0].id == 1);
+            assert(v.Size() == 0);
+
+            SmallVector<Obj, INLINE> v_copy(v_moved);
+            assert(v_copy.Size() == 2);
+            assert(v_copy[1].id == 2);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        // Перемещение спилленного вектора крадёт буфер без переноса элементов
+        Obj::ResetCounters();
+        SmallVector<Obj, 2> v;
+        for (int i = 0; i < 10; ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(!v.IsInline());
+        const int moved_before = Obj::num_moved;
+        SmallVector<Obj, 2> v_moved(std::move(v));
+        assert(Obj::num_moved == moved_before);
+        assert(v_moved.Size() == 10);
+        assert(v_moved[9].id == 9);
+    }
+    {
+        SmallVector<TestObj, 1> v(1);
+        // PushBack собственного элемента безопасен и при спилле из
+        // встроенного буфера
+        v.PushBack(v[0]);
+        assert(v[0].IsAlive());
+        assert(v[1].IsAlive());
+    }
+}
+
+void Test10() {
+    const size_t SIZE = 1'000;
+    {
+        // AppendRange дописывает пачку за одну реаллокацию
+        std::vector<int> batch(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            batch[i] = static_cast<int>(i);
+        }
+        Vector<int> v;
+        v.PushBack(-1);
+        v.AppendRange(batch.begin(), batch.end());
+        assert(v.Size() == SIZE + 1);
+        assert(v[0] == -1);
+        for (size_t i = 0; i < SIZE; ++i) {
+            assert(v[i + 1] == static_cast<int>(i));
+        }
+    }
+    {
+        Obj::ResetCounters();
+        std::vector<Obj> batch;
+        batch.reserve(3);
+        batch.emplace_back(1);
+        batch.emplace_back(2);
+        batch.emplace_back(3);
+
+        Vector<Obj> v;
+        v.Reserve(10);
+        const int copies_before = Obj::num_copied;
+        v.AppendRange(batch.begin(), batch.end());
+        assert(v.Size() == 3);
+        assert(v[2].id == 3);
+        // По одной копии на элемент, без промежуточных переносов
+        assert(Obj::num_copied - copies_before == 3);
+        assert(Obj::num_moved == 0);
+    }
+    {
+        // Assign переиспользует уже сконструированные элементы
+        Obj::ResetCounters();
+        std::vector<Obj> src;
+        src.reserve(2);
+        src.emplace_back(7);
+        src.emplace_back(8);
+
+        Vector<Obj> v(5);
+        v.Assign(src.begin(), src.end());
+        assert(v.Size() == 2);
+        assert(v[0].id == 7);
+        assert(v[1].id == 8);
+        assert(Obj::num_copied == 0);
+        assert(Obj::num_assigned == 2);
+        assert(Obj::GetAliveObjectCount() == 2 + 2);
+    }
+    {
+        // Assign с ростом ёмкости
+        std::vector<int> src(SIZE, 5);
+        Vector<int> v;
+        v.PushBack(1);
+        v.Assign(src.begin(), src.end());
+        assert(v.Size() == SIZE);
+        assert(v[SIZE - 1] == 5);
+    }
+}
+
+void Test11() {
+    const size_t SIZE = 100;
+    {
+        // ShrinkToFit возвращает слабину, ReserveExact умеет ужимать
+        Vector<int> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(static_cast<int>(i));
+        }
+        assert(v.Capacity() == 128);
+        v.ShrinkToFit();
+        assert(v.Capacity() == SIZE);
+        assert(v.Size() == SIZE);
+        assert(v[SIZE - 1] == static_cast<int>(SIZE - 1));
+
+        v.ReserveExact(SIZE + 7);
+        assert(v.Capacity() == SIZE + 7);
+        v.ReserveExact(10);
+        assert(v.Capacity() == SIZE);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        v.Reserve(SIZE);
+        v.EmplaceBack(1);
+        v.EmplaceBack(2);
+        v.ShrinkToFit();
+        assert(v.Capacity() == 2);
+        assert(v[0].id == 1);
+        assert(v[1].id == 2);
+        assert(Obj::GetAliveObjectCount() == 2);
+    }
+    {
+        // Политика полуторного роста
+        Vector<int, DefaultAllocator<int>, GrowthOneAndHalf> v;
+        v.PushBack(1);
+        v.PushBack(2);
+        v.PushBack(3);
+        assert(v.Capacity() == 3);
+        v.PushBack(4);
+        assert(v.Capacity() == 4);
+        v.PushBack(5);
+        assert(v.Capacity() == 6);
+        assert(v[4] == 5);
+    }
+}
+
+void Test12() {
+    const size_t SIZE = 64 * 1024;
+    {
+        // ResizeUninitialized выдаёт ёмкость без зануления
+        Vector<uint8_t> buf;
+        buf.ResizeUninitialized(SIZE);
+        assert(buf.Size() == SIZE);
+        assert(buf.Capacity() >= SIZE);
+        // Буфер пригоден для полной перезаписи
+        for (size_t i = 0; i < SIZE; ++i) {
+            buf[i] = static_cast<uint8_t>(i);
+        }
+        assert(buf[SIZE - 1] == static_cast<uint8_t>(SIZE - 1));
+
+        buf.ResizeUninitialized(SIZE / 2);
+        assert(buf.Size() == SIZE / 2);
+        assert(buf[0] == 0);
+    }
+    {
+        // Для классов ResizeDefaultInit эквивалентен обычному Resize
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        v.ResizeDefaultInit(10);
+        assert(v.Size() == 10);
+        assert(Obj::num_default_constructed == 10);
+        v.ResizeDefaultInit(4);
+        assert(v.Size() == 4);
+        assert(Obj::GetAliveObjectCount() == 4);
+    }
+    {
+        // ResizeAndOverwrite: op заполняет буфер и возвращает реальный размер
+        Vector<char> v;
+        v.ResizeAndOverwrite(SIZE, [](char *data, size_t n) {
+            size_t written = n / 2;
+            std::memset(data, 'x', written);
+            return written;
+        });
+        assert(v.Size() == SIZE / 2);
+        assert(v.Capacity() >= SIZE);
+        assert(v[0] == 'x');
+        assert(v[SIZE / 2 - 1] == 'x');
+    }
+}
+
+void Test13() {
+    const size_t SIZE = 10;
+    {
+        // Erase диапазона — один сдвиг хвоста
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        v.Reserve(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(static_cast<int>(i));
+        }
+        auto *pos = v.Erase(v.cbegin() + 2, v.cbegin() + 6);
+        assert(v.Size() == SIZE - 4);
+        assert(pos - v.begin() == 2);
+        assert(pos->id == 6);
+        assert(v[v.Size() - 1].id == 9);
+        assert(Obj::num_move_assigned == 4);
+        assert(Obj::GetAliveObjectCount() == SIZE - 4);
+
+        // Пустой диапазон — no-op
+        auto *same = v.Erase(v.cbegin() + 1, v.cbegin() + 1);
+        assert(same - v.begin() == 1);
+        assert(v.Size() == SIZE - 4);
+    }
+    {
+        // EraseIf удаляет за один проход
+        Vector<int> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(i);
+        }
+        size_t removed = v.EraseIf([](int x) { return x % 2 == 0; });
+        assert(removed == 50);
+        assert(v.Size() == 50);
+        for (size_t i = 0; i < v.Size(); ++i) {
+            assert(v[i] == static_cast<int>(i) * 2 + 1);
+        }
+    }
+    {
+        // EraseSwapLast: O(1), порядок не сохраняется
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        v.Reserve(4);
+        for (int i = 0; i < 4; ++i) {
+            v.EmplaceBack(i);
+        }
+        auto *pos = v.EraseSwapLast(v.cbegin() + 1);
+        assert(v.Size() == 3);
+        assert(pos->id == 3);
+        assert(v[0].id == 0);
+        assert(v[2].id == 2);
+        assert(Obj::num_move_assigned == 1);
+
+        // Удаление последнего элемента — просто PopBack
+        v.EraseSwapLast(v.cbegin() + 2);
+        assert(v.Size() == 2);
+        assert(Obj::GetAliveObjectCount() == 2);
+    }
+}
+
+namespace {
+
+// Хэндл с нетривиальным деструктором, но без самоссылок: релоцируется
+// побайтово, о чём мы сообщаем специализацией трейта
+    struct RelocHandle {
+        RelocHandle() : payload(new int(0)) {}
+
+        explicit RelocHandle(int value) : payload(new int(value)) {}
+
+        RelocHandle(const RelocHandle &other) : payload(new int(*other.payload)) {
+            ++num_copied;
+        }
+
+        RelocHandle(RelocHandle &&other) noexcept : payload(other.payload) {
+            other.payload = nullptr;
+            ++num_moved;
+        }
+
+        RelocHandle &operator=(const RelocHandle &) = delete;
+
+        ~RelocHandle() {
+            delete payload;
+            ++num_destroyed;
+        }
+
+        int *payload;
+
+        static inline int num_copied = 0;
+        static inline int num_moved = 0;
+        static inline int num_destroyed = 0;
+    };
+
+} // namespace
+
+template<>
+struct IsTriviallyRelocatable<RelocHandle> : std::true_type {};
+
+void Test14() {
+    static_assert(IS_TRIVIALLY_RELOCATABLE<int>);
+    static_assert(!IS_TRIVIALLY_RELOCATABLE<std::string>);
+    static_assert(IS_TRIVIALLY_RELOCATABLE<RelocHandle>);
+
+    const size_t SIZE = 100;
+    RelocHandle::num_copied = 0;
+    RelocHandle::num_moved = 0;
+    RelocHandle::num_destroyed = 0;
+    {
+        Vector<RelocHandle> v;
+        v.Reserve(1);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(static_cast<int>(i));
+        }
+        assert(v.Size() == SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            assert(*v[i].payload == static_cast<int>(i));
+        }
+        // Реаллокации релоцируют байты: ни перемещений, ни копий,
+        // ни вызовов деструктора по старым буферам
+        assert(RelocHandle::num_copied == 0);
+        assert(RelocHandle::num_moved == 0);
+        assert(RelocHandle::num_destroyed == 0);
+
+        v.ShrinkToFit();
+        assert(v.Capacity() == SIZE);
+        assert(RelocHandle::num_moved == 0);
+        assert(*v[SIZE - 1].payload == static_cast<int>(SIZE - 1));
+    }
+    // Деструктор отработал ровно по одному разу на живой элемент
+    assert(RelocHandle::num_destroyed == static_cast<int>(SIZE));
+    {
+        RelocHandle::num_moved = 0;
+        RelocHandle::num_destroyed = 0;
+        SmallVector<RelocHandle, 2> v;
+        for (int i = 0; i < 8; ++i) {
+            v.EmplaceBack(i);
+        }
+        // Спилл из встроенного буфера — тоже релокация без переносов
+        assert(RelocHandle::num_moved == 0);
+        assert(RelocHandle::num_destroyed == 0);
+        assert(*v[7].payload == 7);
+    }
+}
+
+namespace {
+
+// Счётчик живых объектов атомарный: конструкторы зовутся из разных потоков
+    struct Sample {
+        Sample() { ++num_alive; }
+
+        Sample(const Sample &other) : id(other.id) { ++num_alive; }
+
+        ~Sample() { --num_alive; }
+
+        int id = 0;
+
+        static inline std::atomic<int> num_alive = 0;
+    };
+
+} // namespace
+
+void Test15() {
+    const size_t SIZE = 100'000;
+    const size_t THREADS = 4;
+    {
+        auto v = Vector<Sample>::CreateParallel(SIZE, THREADS);
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == SIZE);
+        assert(Sample::num_alive == SIZE);
+
+        v.ResizeParallel(SIZE / 2, THREADS);
+        assert(v.Size() == SIZE / 2);
+        assert(Sample::num_alive == SIZE / 2);
+
+        v.ResizeParallel(SIZE, THREADS);
+        assert(v.Size() == SIZE);
+        assert(Sample::num_alive == SIZE);
+
+        v[SIZE - 1].id = 42;
+        auto v_copy = v.CopyParallel(THREADS);
+        assert(v_copy.Size() == SIZE);
+        assert(v_copy[SIZE - 1].id == 42);
+        assert(Sample::num_alive == 2 * SIZE);
+    }
+    assert(Sample::num_alive == 0);
+    {
+        // Вырожденные случаи: один поток и потоков больше, чем элементов
+        auto v1 = Vector<int>::CreateParallel(10, 1);
+        assert(v1.Size() == 10);
+        auto v2 = Vector<int>::CreateParallel(3, 16);
+        assert(v2.Size() == 3);
+        assert(v2[2] == 0);
+        auto v3 = Vector<int>::CreateParallel(0, 4);
+        assert(v3.Size() == 0);
+    }
+}
+
+namespace {
+
+    // Колонка с бросающим копированием и move без noexcept: при пересадке
+    // такой колонки SoAVector обязан копировать, и копия может бросить
+    // посреди роста
+    struct ThrowingCopyColumn {
+        explicit ThrowingCopyColumn(int id) : id(id) {}
+
+        ThrowingCopyColumn(const ThrowingCopyColumn &other) : id(other.id) {
+            if (copy_throw_countdown > 0 && --copy_throw_countdown == 0) {
+                throw std::runtime_error("Oops");
+            }
+        }
+
+        ThrowingCopyColumn(ThrowingCopyColumn &&other) : id(other.id) {}
+
+        ThrowingCopyColumn &operator=(const ThrowingCopyColumn &) = default;
+
+        int id;
+
+        inline static int copy_throw_countdown = 0;
+    };
+
+} // namespace
+
+void Test16() {
+    const size_t SIZE = 1'000;
+    {
+        SoAVector<uint64_t, float, uint32_t> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(i, static_cast<float>(i) * 0.5f,
+                          static_cast<uint32_t>(i % 7));
+        }
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() >= SIZE);
+
+        // Скан одной колонки — плотный последовательный проход
+        uint64_t sum = 0;
+        for (const uint64_t *p = v.ColumnBegin<0>(); p != v.ColumnEnd<0>(); ++p) {
+            sum += *p;
+        }
+        assert(sum == SIZE * (SIZE - 1) / 2);
+
+        assert(v.Get<2>(8) == 1);
+        auto [key, score, flags] = v.Row(10);
+        assert(key == 10);
+        assert(score == 5.0f);
+        assert(flags == 3);
+
+        v.PopBack();
+        assert(v.Size() == SIZE - 1);
+
+        auto v_copy(v);
+        assert(v_copy.Size() == SIZE - 1);
+        assert(v_copy.Get<0>(100) == 100);
+
+        auto v_moved(std::move(v));
+        assert(v_moved.Size() == SIZE - 1);
+        assert(v.Size() == 0);
+    }
+    {
+        // Нетривиальная колонка: деструкторы отрабатывают по всем колонкам
+        Obj::ResetCounters();
+        {
+            SoAVector<int, Obj> v;
+            v.Reserve(2);
+            v.EmplaceBack(1, Obj{1});
+            v.EmplaceBack(2, Obj{2});
+            // Рост релоцирует обе колонки за одно событие
+            v.EmplaceBack(3, Obj{3});
+            assert(v.Size() == 3);
+            assert(v.Get<1>(2).id == 3);
+            assert(Obj::GetAliveObjectCount() == 3);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        SoAVector<int, std::string> v(3);
+        assert(v.Size() == 3);
+        assert(v.Get<1>(0).empty());
+        v.Resize(1);
+        assert(v.Size() == 1);
+        v.Resize(5);
+        assert(v.Get<0>(4) == 0);
+    }
+    {
+        // Дозапись значений из собственных колонок безопасна и при росте
+        SoAVector<int, std::string> v;
+        v.EmplaceBack(1, std::string(100, 'a'));
+        while (v.Size() < v.Capacity()) {
+            v.EmplaceBack(2, std::string(100, 'b'));
+        }
+        v.EmplaceBack(v.Get<0>(0), v.Get<1>(0));
+        assert(v.Get<0>(v.Size() - 1) == 1);
+        assert(v.Get<1>(v.Size() - 1) == std::string(100, 'a'));
+    }
+    {
+        // Исключение при переносе одной из колонок не разъезжает ёмкости:
+        // либо на новые буферы переезжают все колонки, либо ни одна
+        SoAVector<int, ThrowingCopyColumn> v;
+        v.EmplaceBack(1, ThrowingCopyColumn(10));
+        v.EmplaceBack(2, ThrowingCopyColumn(20));
+        assert(v.Size() == v.Capacity());
+        size_t capacity = v.Capacity();
+        ThrowingCopyColumn::copy_throw_countdown = 1;
+        try {
+            v.EmplaceBack(3, ThrowingCopyColumn(30));
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error &) {
+        }
+        ThrowingCopyColumn::copy_throw_countdown = 0;
+        assert(v.Size() == 2);
+        assert(v.Capacity() == capacity);
+        assert(v.Get<0>(0) == 1 && v.Get<1>(1).id == 20);
+        v.EmplaceBack(3, ThrowingCopyColumn(30));
+        assert(v.Get<1>(2).id == 30);
+    }
+}
+
+void Test17() {
+    const size_t ALIGN = 64;
+    auto is_aligned = [](const void *p) {
+        return reinterpret_cast<uintptr_t>(p) % ALIGN == 0;
+    };
+    {
+        AlignedVector<float, ALIGN> v;
+        for (size_t i = 0; i < 1'000; ++i) {
+            v.PushBack(static_cast<float>(i));
+        }
+        // Выравнивание переживает все реаллокации роста
+        assert(is_aligned(v.begin()));
+        assert(v[999] == 999.0f);
+
+        v.Reserve(10'000);
+        assert(is_aligned(v.begin()));
+
+        v.ShrinkToFit();
+        assert(is_aligned(v.begin()));
+        assert(v.Capacity() == 1'000);
+    }
+    {
+        // Выравнивание работает и для нетривиальных типов
+        AlignedVector<Obj, ALIGN> v;
+        v.EmplaceBack(7);
+        assert(is_aligned(v.begin()));
+        assert(v[0].id == 7);
+    }
+}
+
+void Test18() {
+    const size_t SIZE = 1'000;
+    {
+        // Снимок крадёт буфер, копии снимка делят его без глубоких копий
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        v.Reserve(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(static_cast<int>(i));
+        }
+        const int copies_before = Obj::num_copied;
+        const int moves_before = Obj::num_moved;
+
+        SharedVector<Obj> snapshot(std::move(v));
+        SharedVector<Obj> reader1(snapshot);
+        SharedVector<Obj> reader2(snapshot);
+        assert(Obj::num_copied == copies_before);
+        assert(Obj::num_moved == moves_before);
+
+        assert(reader1.Size() == SIZE);
+        assert(reader2[SIZE - 1].id == static_cast<int>(SIZE - 1));
+        // Все читатели смотрят в один и тот же буфер
+        assert(reader1.begin() == reader2.begin());
+        assert(Obj::GetAliveObjectCount() == SIZE);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        // Publish/Load: обновление — атомарная подмена указателя
+        SharedVectorPublisher<int> publisher;
+        assert(publisher.Load().Size() == 0);
+
+        Vector<int> generation1;
+        generation1.PushBack(1);
+        publisher.Publish(std::move(generation1));
+        SharedVector<int> old_view = publisher.Load();
+        assert(old_view.Size() == 1);
+
+        Vector<int> generation2;
+        generation2.PushBack(1);
+        generation2.PushBack(2);
+        publisher.Publish(std::move(generation2));
+        assert(publisher.Load().Size() == 2);
+        // Старый снимок у читателя остаётся живым и неизменным
+        assert(old_view.Size() == 1);
+        assert(old_view[0] == 1);
+    }
+}
+
+namespace {
+
+    inline int num_external_buffers_freed = 0;
+
+    void FreeExternalBuffer(uint8_t *buffer, size_t /*capacity*/) {
+        std::free(buffer);
+        ++num_external_buffers_freed;
+    }
+
+} // namespace
+
+void Test19() {
+    const size_t SIZE = 1'000;
+    {
+        // Adopt оборачивает готовый буфер без копирования
+        num_external_buffers_freed = 0;
+        auto *raw = static_cast<uint8_t *>(std::malloc(SIZE));
+        for (size_t i = 0; i < SIZE; ++i) {
+            raw[i] = static_cast<uint8_t>(i);
+        }
+        {
+            auto v = AdoptBuffer<uint8_t>(raw, SIZE, SIZE, FreeExternalBuffer);
+            assert(v.Size() == SIZE);
+            assert(v.begin() == raw);
+            assert(v[100] == 100);
+        }
+        // Деструктор вектора освободил буфер пользовательским делитером
+        assert(num_external_buffers_freed == 1);
+    }
+    {
+        // Рост после Adopt пересаживает содержимое в собственный буфер,
+        // а усыновлённый освобождается делитером
+        num_external_buffers_freed = 0;
+        auto *raw = static_cast<uint8_t *>(std::malloc(4));
+        raw[0] = 1;
+        raw[1] = 2;
+        auto v = AdoptBuffer<uint8_t>(raw, 2, 4, FreeExternalBuffer);
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(static_cast<uint8_t>(i));
+        }
+        assert(num_external_buffers_freed == 1);
+        assert(v.Size() == 102);
+        assert(v[0] == 1);
+        assert(v[101] == 99);
+    }
+    {
+        // Release отдаёт буфер без разрушения элементов
+        Vector<int> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+        }
+        auto released = v.Release();
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+        assert(released.size == 10);
+        assert(released.capacity >= 10);
+        assert(released.data[9] == 9);
+        // int тривиально релоцируем, буфер выделен malloc'ом
+        std::free(released.data);
+    }
+}
+
+void Test20() {
+    const size_t SIZE = 10'000;
+    const std::string PATH = "/tmp/advanced_vector_persist_test.bin";
+    {
+        Vector<uint64_t> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(i * i);
+        }
+        SaveVectorTo(v, PATH);
+
+        auto mapped = MapVectorFrom<uint64_t>(PATH, /*validate_checksum=*/true);
+        assert(mapped.Size() == SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            assert(mapped[i] == i * i);
+        }
+
+        // Отображение приватное: запись в вектор не меняет файл
+        mapped[0] = 777;
+        assert(mapped[0] == 777);
+
+        auto mapped_again = MapVectorFrom<uint64_t>(PATH);
+        assert(mapped_again[0] == 0);
+
+        // После mmap вектор остаётся полноценным: растёт и переезжает
+        // в обычную память
+        mapped_again.PushBack(123);
+        assert(mapped_again.Size() == SIZE + 1);
+        assert(mapped_again[SIZE] == 123);
+    }
+    {
+        // Битый файл отвергается
+        Vector<uint32_t> v;
+        v.PushBack(1);
+        SaveVectorTo(v, PATH);
+        try {
+            auto mapped = MapVectorFrom<uint64_t>(PATH);
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error &) {
+        }
+    }
+    {
+        // Гигантский size в заголовке отвергается: умножение на sizeof(T)
+        // переполнило бы проверку длины файла
+        Vector<uint64_t> v;
+        v.PushBack(42);
+        SaveVectorTo(v, PATH);
+        int fd = ::open(PATH.c_str(), O_WRONLY);
+        assert(fd >= 0);
+        const uint64_t huge = uint64_t{1} << 61;
+        ::pwrite(fd, &huge, sizeof(huge),
+                 offsetof(PersistentVectorHeader, size));
+        ::close(fd);
+        try {
+            auto mapped = MapVectorFrom<uint64_t>(PATH);
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error &) {
+        }
+    }
+    std::remove(PATH.c_str());
+}
+
+namespace {
+
+    // Сторонний тип без noexcept-аннотаций: move-конструктор есть, но
+    // формально может бросать, поэтому Strong-вектор при реаллокации
+    // страхуется копиями
+    struct Legacy {
+        Legacy() = default;
+
+        Legacy(const Legacy & /*other*/) { ++num_copies; }
+
+        Legacy(Legacy && /*other*/) { ++num_moves; }
+
+        Legacy &operator=(const Legacy &) = default;
+
+        Legacy &operator=(Legacy &&) = default;
+
+        static void Reset() {
+            num_copies = 0;
+            num_moves = 0;
+        }
+
+        inline static int num_copies = 0;
+        inline static int num_moves = 0;
+    };
+
+    static_assert(!std::is_nothrow_move_constructible_v<Legacy>);
+
+} // namespace
+
+void Test21() {
+    const size_t SIZE = 100;
+    {
+        // Строгая гарантия: реаллокации копируют
+        Legacy::Reset();
+        Vector<Legacy> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.EmplaceBack();
+        }
+        assert(Legacy::num_copies > 0);
+        assert(Legacy::num_moves == 0);
+    }
+    {
+        // Terminate: реаллокации перемещают, копий нет вовсе
+        Legacy::Reset();
+        TerminatingVector<Legacy> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.EmplaceBack();
+        }
+        assert(Legacy::num_copies == 0);
+        assert(Legacy::num_moves > 0);
+    }
+    {
+        // Вставка в середину с переполнением тоже идёт через move
+        Legacy::Reset();
+        TerminatingVector<Legacy> v;
+        v.EmplaceBack();
+        while (v.Size() < v.Capacity()) {
+            v.EmplaceBack();
+        }
+        v.Emplace(v.begin());
+        assert(Legacy::num_copies == 0);
+        assert(Legacy::num_moves > 0);
+    }
+}
+
+void Test22() {
+    {
+        // Вставка диапазона: с ростом буфера и без него
+        Vector<int> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+        }
+        const int batch[] = {100, 101, 102};
+        auto it = v.Insert(v.begin() + 5, std::begin(batch), std::end(batch));
+        assert(it == v.begin() + 5);
+        assert(v.Size() == 13);
+        assert(v[4] == 4 && v[5] == 100 && v[7] == 102 && v[8] == 5 && v[12] == 9);
+
+        v.Reserve(32);
+        v.Insert(v.begin(), std::begin(batch), std::end(batch));
+        assert(v.Size() == 16);
+        assert(v[0] == 100 && v[2] == 102 && v[3] == 0);
+
+        v.Insert(v.end(), std::begin(batch), std::end(batch));
+        assert(v.Size() == 19);
+        assert(v[18] == 102);
+    }
+    {
+        // count копий value, в том числе ссылающегося внутрь самого вектора
+        Vector<int> v;
+        for (int i = 0; i < 8; ++i) {
+            v.PushBack(i);
+        }
+        v.Insert(v.begin() + 1, 3, v[7]);
+        assert(v.Size() == 11);
+        assert(v[0] == 0 && v[1] == 7 && v[3] == 7 && v[4] == 1 && v[10] == 7);
+    }
+    {
+        // Хвост сдвигается один раз, а не по разу на вставляемый элемент
+        Vector<Obj> v;
+        v.Reserve(16);
+        for (int i = 0; i < 8; ++i) {
+            v.EmplaceBack(i);
+        }
+        Vector<Obj> batch;
+        batch.Reserve(4);
+        for (int i = 100; i < 104; ++i) {
+            batch.EmplaceBack(i);
+        }
+        Obj::ResetCounters();
+        v.Insert(v.begin() + 2, batch.begin(), batch.end());
+        // Хвост из 6 элементов: 4 move-конструкции в сырую память плюс
+        // 2 move-присваивания; новые элементы копируются из batch
+        assert(Obj::num_moved == 4);
+        assert(Obj::num_move_assigned == 2);
+        assert(Obj::num_assigned == 4);
+        assert(Obj::num_copied == 0);
+        assert(v.Size() == 12);
+        assert(v[1].id == 1 && v[2].id == 100 && v[5].id == 103 && v[6].id == 2);
+    }
+    {
+        // Однопроходные итераторы: длина диапазона неизвестна заранее
+        std::istringstream input("7 8 9");
+        Vector<int> v;
+        v.PushBack(1);
+        v.PushBack(2);
+        v.Insert(v.begin() + 1, std::istream_iterator<int>(input),
+                 std::istream_iterator<int>());
+        assert(v.Size() == 5);
+        assert(v[0] == 1 && v[1] == 7 && v[3] == 9 && v[4] == 2);
+    }
+}
+
+namespace {
+
+    inline size_t num_realloc_callbacks = 0;
+    inline size_t last_new_capacity = 0;
+
+    void CountReallocation(size_t element_size, size_t old_capacity,
+                           size_t new_capacity, size_t /*size*/) {
+        assert(element_size == sizeof(Obj));
+        assert(new_capacity > old_capacity);
+        ++num_realloc_callbacks;
+        last_new_capacity = new_capacity;
+    }
+
+} // namespace
+
+void Test23() {
+    const size_t SIZE = 1'000;
+    {
+        // Счётчики реаллокаций и перенесённых байтов
+        ThreadVectorStats().Reset();
+        Vector<Obj> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(static_cast<int>(i));
+        }
+        const VectorStats &stats = ThreadVectorStats();
+        assert(stats.num_reallocations > 0);
+        assert(stats.bytes_moved > 0);
+        assert(stats.peak_capacity_bytes == v.Capacity() * sizeof(Obj));
+        assert(stats.wasted_bytes > 0);
+    }
+    {
+        // Расширение на месте через realloc — тоже рост, но без переноса
+        ThreadVectorStats().Reset();
+        Vector<int> v;
+        v.PushBack(1);
+        assert(ThreadVectorStats().num_reallocations >= 1);
+    }
+    {
+        // Колбэк видит каждую реаллокацию с растущей ёмкостью
+        SetReallocationCallback(CountReallocation);
+        num_realloc_callbacks = 0;
+        Vector<Obj> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(static_cast<int>(i));
+        }
+        SetReallocationCallback(nullptr);
+        assert(num_realloc_callbacks > 0);
+        assert(last_new_capacity == v.Capacity());
+    }
+}
+
+void Test24() {
+    {
+        // Из initializer_list: ёмкость точно по размеру
+        Vector<int> v{1, 2, 3, 4, 5};
+        assert(v.Size() == 5);
+        assert(v.Capacity() == 5);
+        assert(v[0] == 1 && v[4] == 5);
+    }
+    {
+        // Из пары forward-итераторов — одно выделение, по копии на элемент
+        std::vector<Obj> source;
+        for (int i = 0; i < 10; ++i) {
+            source.emplace_back(i);
+        }
+        Obj::ResetCounters();
+        Vector<Obj> v(source.begin(), source.end());
+        assert(v.Size() == 10);
+        assert(v.Capacity() == 10);
+        assert(v[9].id == 9);
+        assert(Obj::num_copied == 10);
+        assert(Obj::num_moved == 0);
+    }
+    {
+        // Однопроходные итераторы: длина неизвестна, растём по политике
+        std::istringstream input("10 20 30");
+        Vector<int> v{std::istream_iterator<int>(input),
+                      std::istream_iterator<int>()};
+        assert(v.Size() == 3);
+        assert(v[0] == 10 && v[2] == 30);
+    }
+    {
+        // Пустой диапазон не выделяет память
+        Vector<int> v(std::initializer_list<int>{});
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+    }
+}
+
+namespace {
+
+    // Таблица CRC32 считается на этапе компиляции и ложится в .rodata
+    constexpr std::array<uint32_t, 256> MakeCrc32Table() {
+        Vector<uint32_t> table;
+        table.Reserve(256);
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ ((crc & 1) != 0 ? 0xEDB88320u : 0u);
+            }
+            table.PushBack(crc);
+        }
+        std::array<uint32_t, 256> result{};
+        std::copy(table.begin(), table.end(), result.begin());
+        return result;
+    }
+
+    constexpr auto CRC32_TABLE = MakeCrc32Table();
+
+    static_assert(CRC32_TABLE[1] == 0x77073096u);
+    static_assert(CRC32_TABLE[255] == 0x2D02EF8Du);
+
+    // Основное API целиком работоспособно при константных вычислениях
+    constexpr bool ConstexprVectorSmoke() {
+        Vector<int> v{1, 2, 3};
+        v.Insert(v.begin() + 1, 2, 9);
+        v.Erase(v.begin());
+        v.EmplaceBack(4);
+        v.Resize(8);
+        v.ShrinkToFit();
+
+        Vector<int> copy(v);
+        copy = v;
+        copy.Assign(v.begin(), v.end() - 1);
+        copy.EraseIf([](int value) { return value == 9; });
+
+        Vector<std::pair<int, int>> pairs;
+        pairs.EmplaceBack(1, 2);
+
+        return v.Size() == 8 && v[0] == 9 && v[2] == 2 && v[7] == 0 &&
+               v.Capacity() == 8 && copy.Size() == 5 &&
+               pairs[0].second == 2;
+    }
+
+    static_assert(ConstexprVectorSmoke());
+
+} // namespace
+
+void Test25() {
+    // Результаты на этапе компиляции и в рантайме совпадают
+    assert(ConstexprVectorSmoke());
+    Vector<uint32_t> runtime_table(CRC32_TABLE.begin(), CRC32_TABLE.end());
+    assert(runtime_table.Size() == 256);
+    assert(runtime_table[255] == CRC32_TABLE[255]);
+}
+
+void Test26() {
+    {
+        // Группа дописывается целиком, порядок аргументов сохраняется
+        Vector<int> v;
+        for (int i = 0; i < 100; i += 3) {
+            v.PushBackN(i, i + 1, i + 2);
+        }
+        assert(v.Size() == 102);
+        for (int i = 0; i < 102; ++i) {
+            assert(v[i] == i);
+        }
+    }
+    {
+        // Переполнение посреди группы — ровно одна реаллокация
+        Vector<Obj> v;
+        v.Reserve(4);
+        v.EmplaceBackN(Obj(1), Obj(2), Obj(3));
+        ThreadVectorStats().Reset();
+        v.EmplaceBackN(Obj(4), Obj(5), Obj(6));
+        assert(ThreadVectorStats().num_reallocations == 1);
+        assert(v.Size() == 6);
+        assert(v[0].id == 1 && v[3].id == 4 && v[5].id == 6);
+    }
+    {
+        // Исключение на середине группы откатывает её целиком
+        Vector<Obj> v;
+        v.EmplaceBack(7);
+        Obj poisoned(8);
+        poisoned.throw_on_copy = true;
+        const size_t old_size = v.Size();
+        try {
+            v.PushBackN(v[0], poisoned, Obj(9));
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error &) {
+        }
+        assert(v.Size() == old_size);
+        assert(v[0].id == 7);
+    }
+    {
+        // Группа работает и при константных вычислениях
+        constexpr int sum = [] {
+            Vector<int> v;
+            v.EmplaceBackN(1, 2, 3, 4);
+            return v[0] + v[1] + v[2] + v[3];
+        }();
+        static_assert(sum == 10);
+    }
+}
+
+void Test27() {
+    {
+        // FIFO-порядок с заворотом и ростом посреди заворота
+        RingVector<int> ring;
+        int next_in = 0;
+        int next_out = 0;
+        for (int round = 0; round < 1'000; ++round) {
+            while (ring.Size() < 7) {
+                ring.PushBack(next_in++);
+            }
+            assert(ring.Front() == next_out);
+            assert(ring.Back() == next_in - 1);
+            assert(ring[2] == next_out + 2);
+            for (int i = 0; i < 5; ++i) {
+                assert(ring.Front() == next_out++);
+                ring.PopFront();
+            }
+        }
+        assert(ring.Size() == 2);
+    }
+    {
+        // После Reserve стационарный цикл очереди не переносит элементы
+        RingVector<Obj> ring;
+        ring.Reserve(8);
+        for (int i = 0; i < 4; ++i) {
+            ring.EmplaceBack(i);
+        }
+        Obj::ResetCounters();
+        for (int i = 4; i < 1'000; ++i) {
+            ring.EmplaceBack(i);
+            ring.PopFront();
+        }
+        assert(Obj::num_moved == 0);
+        assert(Obj::num_copied == 0);
+        assert(ring.Size() == 4);
+        assert(ring.Front().id == 996);
+    }
+    {
+        // Сегменты покрывают содержимое целиком и в порядке очереди
+        RingVector<int> ring(4);
+        ring.PushBack(1);
+        ring.PushBack(2);
+        ring.PushBack(3);
+        ring.PopFront();
+        ring.PopFront();
+        ring.PushBack(4);
+        ring.PushBack(5);
+        auto [first, second] = ring.Segments();
+        assert(first.size + second.size == ring.Size());
+        assert(first.data[0] == 3);
+        assert(second.size == 1 && second.data[0] == 5);
+    }
+    {
+        // Копия выпрямляет очередь, источник не меняется
+        RingVector<std::string> ring(2);
+        ring.PushBack("a");
+        ring.PushBack("b");
+        ring.PopFront();
+        ring.PushBack("c");
+        RingVector<std::string> copy(ring);
+        assert(copy.Size() == 2);
+        assert(copy.Front() == "b" && copy.Back() == "c");
+        assert(ring.Front() == "b");
+        copy.Clear();
+        assert(copy.IsEmpty());
+    }
+    {
+        // Дозапись собственного элемента безопасна и при росте с пересадкой
+        RingVector<std::string> ring(2);
+        ring.PushBack(std::string(100, 'q'));
+        ring.PushBack(std::string(100, 'w'));
+        ring.PushBack(ring.Front());
+        assert(ring.Size() == 3);
+        assert(ring.Back() == std::string(100, 'q'));
+        assert(ring.Front() == ring.Back());
+    }
+}
+
+void Test28() {
+    const size_t NUM_THREADS = 8;
+    const size_t PER_THREAD = 10'000;
+    {
+        // Продюсеры пишут без блокировок, ни один элемент не теряется
+        Vector<size_t> v;
+        ConcurrentAppender appender(v, NUM_THREADS * PER_THREAD);
+        Vector<std::thread> workers;
+        workers.Reserve(NUM_THREADS);
+        for (size_t t = 0; t < NUM_THREADS; ++t) {
+            workers.EmplaceBack([&appender, t] {
+                for (size_t i = 0; i < PER_THREAD; ++i) {
+                    appender.EmplaceBack(t * PER_THREAD + i);
+                }
+            });
+        }
+        for (size_t t = 0; t < NUM_THREADS; ++t) {
+            workers[t].join();
+        }
+        assert(appender.Finish() == NUM_THREADS * PER_THREAD);
+        assert(v.Size() == NUM_THREADS * PER_THREAD);
+
+        // Каждое значение встречается ровно один раз
+        Vector<char> seen(NUM_THREADS * PER_THREAD);
+        for (size_t i = 0; i < v.Size(); ++i) {
+            assert(v[i] < seen.Size());
+            assert(seen[v[i]] == 0);
+            seen[v[i]] = 1;
+        }
+    }
+    {
+        // Дозапись в непустой вектор сохраняет префикс; лишний резерв
+        // просто остаётся ёмкостью
+        Vector<Obj> v;
+        v.EmplaceBack(1);
+        v.EmplaceBack(2);
+        ConcurrentAppender appender(v, 10);
+        appender.EmplaceBack(3);
+        appender.EmplaceBack(4);
+        assert(appender.Finish() == 2);
+        assert(v.Size() == 4);
+        assert(v[0].id == 1 && v[2].id == 3 && v[3].id == 4);
+        assert(v.Capacity() >= 12);
+    }
+}
+
+void Test29() {
+    const size_t SIZE = 100'000;
+    {
+        // Рост без переноса: адреса элементов стабильны навсегда
+        SegmentedVector<size_t, 256> v;
+        v.PushBack(42);
+        const size_t *first = &v[0];
+        for (size_t i = 1; i < SIZE; ++i) {
+            v.PushBack(i);
+        }
+        assert(&v[0] == first);
+        assert(v.Size() == SIZE);
+        assert(v[0] == 42 && v[255] == 255 && v[256] == 256 &&
+               v[SIZE - 1] == SIZE - 1);
+        assert(v.Capacity() >= SIZE);
+
+        // Итератор произвольного доступа работает со стандартными
+        // алгоритмами поверх кусков
+        assert(static_cast<size_t>(std::distance(v.begin(), v.end())) == SIZE);
+        auto it = std::find(v.begin(), v.end(), size_t{300});
+        assert(it != v.end() && it - v.begin() == 300);
+        size_t sum = 0;
+        for (size_t value: v) {
+            sum += value;
+        }
+        assert(sum == SIZE * (SIZE - 1) / 2 + 42);
+    }
+    {
+        // Нетривиальные элементы не перемещаются при росте
+        SegmentedVector<Obj, 16> v;
+        Obj::ResetCounters();
+        for (int i = 0; i < 100; ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(Obj::num_moved == 0);
+        assert(Obj::num_copied == 0);
+        v.PopBack();
+        assert(v.Size() == 99);
+        assert(v.Capacity() == 112);
+
+        SegmentedVector<Obj, 16> copy(v);
+        assert(copy.Size() == 99);
+        assert(copy[98].id == 98);
+        copy.Clear();
+        assert(copy.IsEmpty());
+        assert(Obj::GetAliveObjectCount() == 99);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test30() {
+    const size_t SIZE = 10'000;
+    {
+        Vector<uint64_t> v(SIZE);
+        Fill(v, uint64_t{7});
+        assert(v[0] == 7 && v[SIZE / 2] == 7 && v[SIZE - 1] == 7);
+
+        v[SIZE - 3] = 1;
+        v[123] = 99;
+        v[4'567] = 99;
+        assert(Find(v, uint64_t{99}) == v.begin() + 123);
+        assert(Find(v, uint64_t{12345}) == v.end());
+        assert(MinElement(v) == v.begin() + (SIZE - 3));
+        assert(MaxElement(v) == v.begin() + 123);
+        assert(Sum(v) == 7 * (SIZE - 3) + 1 + 99 + 99);
+        assert(CountIf(v, [](uint64_t x) { return x == 99; }) == 2);
+    }
+    {
+        // Сравнение с эталонными алгоритмами на float
+        Vector<float> v;
+        v.Reserve(1'001);
+        for (int i = 0; i < 1'001; ++i) {
+            v.PushBack(static_cast<float>((i * 37) % 1'000) - 500.0f);
+        }
+        assert(MinElement(v) ==
+               std::min_element(v.begin(), v.end()));
+        assert(MaxElement(v) ==
+               std::max_element(v.begin(), v.end()));
+        float expected = 0.0f;
+        for (float x: v) {
+            expected += x;
+        }
+        // Порядок сложения другой, но на этих данных суммы совпадают точно
+        assert(Sum(v) == expected);
+        assert(CountIf(v, [](float x) { return x > 0.0f; }) ==
+               static_cast<size_t>(std::count_if(
+                       v.begin(), v.end(), [](float x) { return x > 0.0f; })));
+    }
+    {
+        // Пустой вектор
+        Vector<int> v;
+        assert(Find(v, 1) == v.end());
+        assert(MinElement(v) == v.end());
+        assert(MaxElement(v) == v.end());
+        assert(Sum(v) == 0);
+        assert(CountIf(v, [](int) { return true; }) == 0);
+    }
+}
+
+namespace {
+
+    struct ObjIdLess {
+        bool operator()(const Obj &lhs, const Obj &rhs) const {
+            return lhs.id < rhs.id;
+        }
+    };
+
+} // namespace
+
+void Test31() {
+    const size_t SIZE = 1'000;
+    {
+        // Пакетная вставка перемешанных ключей даёт сортированный индекс
+        Vector<int> batch;
+        batch.Reserve(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            batch.PushBack(static_cast<int>(i * 37 % SIZE));
+        }
+        SortedVector<int> index;
+        index.InsertBatch(batch.begin(), batch.end());
+        assert(index.Size() == SIZE);
+        assert(std::is_sorted(index.begin(), index.end()));
+
+        // Поиск согласован с эталоном
+        for (int value: {0, 1, 499, 999, -5, 1'000}) {
+            assert(index.LowerBound(value) ==
+                   std::lower_bound(index.begin(), index.end(), value));
+        }
+        assert(index.Contains(500));
+        assert(!index.Contains(-1));
+        assert(index.Find(777) != index.end() && *index.Find(777) == 777);
+    }
+    {
+        // Одиночные вставки сливаются лениво, дубликаты сохраняются
+        SortedVector<int> index;
+        index.Insert(5);
+        index.Insert(1);
+        index.Insert(5);
+        index.Insert(3);
+        assert(index.Size() == 4);
+        assert(index[0] == 1 && index[1] == 3 && index[2] == 5 && index[3] == 5);
+    }
+    {
+        // Вставка пачки в уже наполненный индекс — один слияющий проход,
+        // а не по сдвигу хвоста на каждый ключ
+        SortedVector<Obj, ObjIdLess> index;
+        Vector<Obj> initial;
+        initial.Reserve(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            initial.EmplaceBack(static_cast<int>(i * 2));
+        }
+        index.InsertBatch(initial.begin(), initial.end());
+
+        Vector<Obj> batch;
+        batch.Reserve(100);
+        for (int i = 0; i < 100; ++i) {
+            batch.EmplaceBack(i * 19 % 200);
+        }
+        Obj::ResetCounters();
+        index.InsertBatch(batch.begin(), batch.end());
+        // Квадратичная вставка стоила бы порядка 100 * 1000 переносов
+        assert(Obj::num_moved + Obj::num_move_assigned < 20'000);
+        assert(index.Size() == SIZE + 100);
+        ObjIdLess less;
+        assert(std::is_sorted(index.begin(), index.end(), less));
+    }
+}
+
+void Test32() {
+    {
+        // At() возвращает те же ссылки, что и operator[], и пригоден для
+        // записи
+        Vector<int> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+        }
+        for (size_t i = 0; i < v.Size(); ++i) {
+            assert(&v.At(i) == &v[i]);
+        }
+        v.At(3) = 42;
+        assert(v[3] == 42);
+
+        const Vector<int> &cv = v;
+        assert(&cv.At(7) == &cv[7]);
+    }
+    {
+        // Проверка границ не мешает constexpr-вычислениям: корректный
+        // индекс не доходит до trap-ветки
+        constexpr int value = [] {
+            Vector<int> v;
+            v.PushBack(10);
+            v.PushBack(20);
+            return v.At(0) + v.At(1);
+        }();
+        static_assert(value == 30);
+    }
+}
+
+void Test33() {
+    {
+        // Пустой получатель забирает буфер источника целиком: тот же адрес
+        // данных, ни одного переноса или копии элементов
+        Vector<Obj> src;
+        src.Reserve(10);
+        for (int i = 0; i < 10; ++i) {
+            src.EmplaceBack(i);
+        }
+        const Obj *buffer = src.begin();
+        Obj::ResetCounters();
+        Vector<Obj> dst;
+        dst.Append(std::move(src));
+        assert(dst.Size() == 10);
+        assert(dst.begin() == buffer);
+        assert(Obj::num_moved == 0 && Obj::num_copied == 0);
+        assert(dst[7].id == 7);
+    }
+    {
+        // Дозапись в непустой вектор переносит элементы, сохраняя порядок
+        Vector<Obj> dst;
+        dst.Reserve(8);
+        dst.EmplaceBack(1);
+        dst.EmplaceBack(2);
+        Vector<Obj> shard;
+        shard.Reserve(3);
+        for (int i = 3; i <= 5; ++i) {
+            shard.EmplaceBack(i);
+        }
+        Obj::ResetCounters();
+        dst.Append(std::move(shard));
+        assert(dst.Size() == 5);
+        assert(Obj::num_moved == 3 && Obj::num_copied == 0);
+        for (int i = 0; i < 5; ++i) {
+            assert(dst[i].id == i + 1);
+        }
+    }
+    {
+        // Вставка целого вектора в середину раздвигает хвост один раз
+        Vector<int> dst;
+        for (int i = 0; i < 5; ++i) {
+            dst.PushBack(i);
+        }
+        Vector<int> src;
+        for (int i = 100; i < 103; ++i) {
+            src.PushBack(i);
+        }
+        Vector<int>::iterator it = dst.Insert(dst.cbegin() + 2, std::move(src));
+        assert(it == dst.begin() + 2);
+        const int expected[] = {0, 1, 100, 101, 102, 2, 3, 4};
+        assert(dst.Size() == 8);
+        assert(std::equal(dst.begin(), dst.end(), std::begin(expected)));
+    }
+    {
+        // Insert в пустой получатель — тоже обмен буферами
+        Vector<Obj> src;
+        src.Reserve(4);
+        for (int i = 0; i < 4; ++i) {
+            src.EmplaceBack(i);
+        }
+        const Obj *buffer = src.begin();
+        Obj::ResetCounters();
+        Vector<Obj> dst;
+        dst.Insert(dst.cbegin(), std::move(src));
+        assert(dst.begin() == buffer && dst.Size() == 4);
+        assert(Obj::num_moved == 0 && Obj::num_copied == 0);
+    }
+}
+
+void Test34() {
+    {
+        // Буфер живёт на mmap-страницах и переживает реаллокации роста
+        HugePageVector<uint64_t> v;
+        const size_t SIZE = 100'000;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            assert(v[i] == i);
+        }
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % 4'096 == 0);
+    }
+    {
+        // NUMA-политика задаётся на вектор и едет вместе с аллокатором;
+        // на одноузловой машине mbind — best-effort no-op
+        HugePageVector<int> v(
+                HugePageAllocator<int>(NumaPlacement::Interleave));
+        for (int i = 0; i < 10'000; ++i) {
+            v.PushBack(i);
+        }
+        assert(v[9'999] == 9'999);
+
+        HugePageVector<int> bound(
+                HugePageAllocator<int>(NumaPlacement::Bind, 0));
+        bound.Resize(1'000);
+        assert(bound.Size() == 1'000 && bound[500] == 0);
+    }
+}
+
+void Test35() {
+    const std::string PATH = "/tmp/advanced_vector_stream_test.bin";
+    {
+        // Тривиальные T уходят в дескриптор одним write и возвращаются
+        // одним read поверх неинициализированного буфера
+        const size_t SIZE = 50'000;
+        Vector<uint64_t> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(i * 3);
+        }
+        int fd = ::open(PATH.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+        assert(fd >= 0);
+        WriteVectorTo(v, fd);
+        ::close(fd);
+
+        fd = ::open(PATH.c_str(), O_RDONLY);
+        assert(fd >= 0);
+        Vector<uint64_t> restored = ReadVectorFrom<uint64_t>(fd);
+        ::close(fd);
+        assert(restored.Size() == SIZE);
+        assert(std::equal(v.begin(), v.end(), restored.begin()));
+    }
+    {
+        // Нетривиальные T сериализуются кодеком: длина плюс байты строки,
+        // весь поток пишется и читается одной порцией
+        auto encode = [](const std::string &s, Vector<char> &out) {
+            uint32_t len = static_cast<uint32_t>(s.size());
+            const char *raw = reinterpret_cast<const char *>(&len);
+            out.AppendRange(raw, raw + sizeof(len));
+            out.AppendRange(s.data(), s.data() + s.size());
+        };
+        auto decode = [](const char *&cursor, const char *end) {
+            uint32_t len = 0;
+            assert(cursor + sizeof(len) <= end);
+            std::memcpy(&len, cursor, sizeof(len));
+            cursor += sizeof(len);
+            assert(cursor + len <= end);
+            std::string s(cursor, len);
+            cursor += len;
+            return s;
+        };
+
+        Vector<std::string> v;
+        v.PushBack("alpha");
+        v.PushBack("");
+        v.PushBack(std::string(1'000, 'x'));
+        int fd = ::open(PATH.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+        assert(fd >= 0);
+        WriteVectorTo(v, fd, encode);
+        ::close(fd);
+
+        fd = ::open(PATH.c_str(), O_RDONLY);
+        assert(fd >= 0);
+        Vector<std::string> restored =
+                ReadVectorFrom<std::string>(fd, decode);
+        ::close(fd);
+        assert(restored.Size() == 3);
+        assert(std::equal(v.begin(), v.end(), restored.begin()));
+    }
+    {
+        // Формат общий с персистентностью: файл из WriteVectorTo читается
+        // MapVectorFrom без копирования
+        Vector<uint32_t> v;
+        for (uint32_t i = 0; i < 100; ++i) {
+            v.PushBack(i * 7);
+        }
+        int fd = ::open(PATH.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+        assert(fd >= 0);
+        WriteVectorTo(v, fd);
+        ::close(fd);
+
+        auto mapped = MapVectorFrom<uint32_t>(PATH, /*validate_checksum=*/true);
+        assert(mapped.Size() == 100);
+        assert(std::equal(v.begin(), v.end(), mapped.begin()));
+    }
+    {
+        // Переполняющий счётчик элементов отвергается до аллокации буфера
+        Vector<uint64_t> v;
+        v.PushBack(7);
+        int fd = ::open(PATH.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+        assert(fd >= 0);
+        WriteVectorTo(v, fd);
+        const uint64_t huge = uint64_t{1} << 61;
+        ::pwrite(fd, &huge, sizeof(huge),
+                 offsetof(PersistentVectorHeader, size));
+        ::close(fd);
+
+        fd = ::open(PATH.c_str(), O_RDONLY);
+        assert(fd >= 0);
+        try {
+            auto restored = ReadVectorFrom<uint64_t>(fd);
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error &) {
+        }
+        ::close(fd);
+    }
+}
+
 struct C {
     C() noexcept { ++def_ctor; }
 
@@ -646,6 +2338,35 @@ int main() {
         Test4();
         Test5();
         Test6();
+        Test7();
+        Test8();
+        Test9();
+        Test10();
+        Test11();
+        Test12();
+        Test13();
+        Test14();
+        Test15();
+        Test16();
+        Test17();
+        Test18();
+        Test19();
+        Test20();
+        Test21();
+        Test22();
+        Test23();
+        Test24();
+        Test25();
+        Test26();
+        Test27();
+        Test28();
+        Test29();
+        Test30();
+        Test31();
+        Test32();
+        Test33();
+        Test34();
+        Test35();
         Benchmark();
     } catch (const std::exception &e) {
         std::cerr << e.what() << std::endl;
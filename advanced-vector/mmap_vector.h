@@ -0,0 +1,248 @@
+#pragma once
+
+#include "allocators.h"
+#include "vector.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Персистентные векторы тривиально копируемых типов: SaveVectorTo пишет
+// буфер одним куском с небольшим заголовком, MapVectorFrom отображает файл
+// через mmap — старт сводится к mmap и подгрузке страниц по требованию,
+// read-only реплики делят страничный кэш между процессами. Отображение
+// приватное (copy-on-write), так что записи в вектор файл не трогают.
+// WriteVectorTo/ReadVectorFrom работают с уже открытым дескриптором
+// (сокет, пайп, чекпойнт-файл) в том же формате; для нетривиальных T есть
+// перегрузки с поэлементным кодеком поверх промежуточного буфера
+
+// Заголовок фиксированного размера в начале файла; 64 байта покрывают
+// выравнивание любых разумных T после страничного mmap-базового адреса
+struct PersistentVectorHeader {
+    uint64_t magic;
+    uint64_t element_size;
+    uint64_t size;
+    uint64_t checksum;
+    uint64_t reserved[4];
+};
+
+static_assert(sizeof(PersistentVectorHeader) == 64);
+
+inline constexpr uint64_t PERSISTENT_VECTOR_MAGIC = 0x52'54'43'56'56'44'41'21; // "!ADVVCTR"
+
+// FNV-1a по байтам содержимого — дёшево и достаточно, чтобы поймать
+// усечённый или побитый файл
+inline uint64_t Fnv1aHash(const void *data, size_t bytes) {
+    const auto *p = static_cast<const unsigned char *>(data);
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < bytes; ++i) {
+        hash ^= p[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+namespace detail {
+
+    inline void WriteAll(int fd, const void *data, size_t bytes) {
+        const char *p = static_cast<const char *>(data);
+        while (bytes > 0) {
+            ssize_t written = ::write(fd, p, bytes);
+            if (written < 0) {
+                throw std::runtime_error("Ошибка записи файла вектора");
+            }
+            p += written;
+            bytes -= static_cast<size_t>(written);
+        }
+    }
+
+    inline void ReadAll(int fd, void *data, size_t bytes) {
+        char *p = static_cast<char *>(data);
+        while (bytes > 0) {
+            ssize_t got = ::read(fd, p, bytes);
+            if (got <= 0) {
+                throw std::runtime_error("Ошибка чтения файла вектора");
+            }
+            p += got;
+            bytes -= static_cast<size_t>(got);
+        }
+    }
+
+} // namespace detail
+
+// Освобождение буфера, полученного из MapVectorFrom: munmap всего
+// отображения, включая заголовок перед данными
+template<typename T>
+void UnmapVectorBuffer(T *buffer, size_t capacity) {
+    auto *base = reinterpret_cast<char *>(buffer) - sizeof(PersistentVectorHeader);
+    ::munmap(base, sizeof(PersistentVectorHeader) + capacity * sizeof(T));
+}
+
+// Пишет вектор в открытый дескриптор: заголовок плюс один write всего
+// буфера, без поэлементного цикла в пользовательском коде
+template<typename T, typename Allocator, typename GrowthPolicy,
+        ExceptionPolicy Policy>
+void WriteVectorTo(const Vector<T, Allocator, GrowthPolicy, Policy> &v,
+                   int fd) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Персистентность поддерживается для тривиально копируемых T");
+    PersistentVectorHeader header{};
+    header.magic = PERSISTENT_VECTOR_MAGIC;
+    header.element_size = sizeof(T);
+    header.size = v.Size();
+    header.checksum = Fnv1aHash(v.begin(), v.Size() * sizeof(T));
+    detail::WriteAll(fd, &header, sizeof(header));
+    detail::WriteAll(fd, v.begin(), v.Size() * sizeof(T));
+}
+
+// Пишет вектор нетривиальных T поэлементным кодеком: encode(value, out)
+// дописывает байтовое представление элемента в out. Элементы кодируются в
+// промежуточный буфер и уходят в дескриптор одним write вместо syscall на
+// элемент; длина закодированного потока хранится в reserved[0], а нулевой
+// element_size отличает такой файл от сырого дампа
+template<typename T, typename Allocator, typename GrowthPolicy,
+        ExceptionPolicy Policy, typename Encoder>
+void WriteVectorTo(const Vector<T, Allocator, GrowthPolicy, Policy> &v,
+                   int fd, Encoder encode) {
+    Vector<char> staging;
+    for (const T &value: v) {
+        encode(value, staging);
+    }
+    PersistentVectorHeader header{};
+    header.magic = PERSISTENT_VECTOR_MAGIC;
+    header.element_size = 0;
+    header.size = v.Size();
+    header.checksum = Fnv1aHash(staging.begin(), staging.Size());
+    header.reserved[0] = staging.Size();
+    detail::WriteAll(fd, &header, sizeof(header));
+    detail::WriteAll(fd, staging.begin(), staging.Size());
+}
+
+// Читает сырой дамп тривиально копируемых T: буфер заполняется одним read
+// поверх неинициализированной памяти
+template<typename T>
+Vector<T> ReadVectorFrom(int fd) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Персистентность поддерживается для тривиально копируемых T");
+    PersistentVectorHeader header{};
+    detail::ReadAll(fd, &header, sizeof(header));
+    // header.size приходит извне: без верхней границы умножение на
+    // sizeof(T) при выделении буфера переполнилось бы и «успешная»
+    // крошечная аллокация породила бы вектор без хранилища
+    if (header.magic != PERSISTENT_VECTOR_MAGIC ||
+        header.element_size != sizeof(T) ||
+        header.size > SIZE_MAX / sizeof(T)) {
+        throw std::runtime_error("Повреждённый заголовок вектора");
+    }
+    Vector<T> result;
+    result.ResizeUninitialized(header.size);
+    detail::ReadAll(fd, result.begin(), header.size * sizeof(T));
+    if (Fnv1aHash(result.begin(), header.size * sizeof(T)) != header.checksum) {
+        throw std::runtime_error("Повреждённое содержимое вектора");
+    }
+    return result;
+}
+
+// Читает поток, записанный кодеком: decode(cursor, end) разбирает один
+// элемент, продвигая cursor. Поток целиком поднимается в промежуточный
+// буфер — элемент не может попасть на границу порций чтения
+template<typename T, typename Decoder>
+Vector<T> ReadVectorFrom(int fd, Decoder decode) {
+    PersistentVectorHeader header{};
+    detail::ReadAll(fd, &header, sizeof(header));
+    // Счётчик элементов и длина потока ограничиваются до аллокаций — те же
+    // соображения переполнения, что и в перегрузке для тривиальных T
+    if (header.magic != PERSISTENT_VECTOR_MAGIC || header.element_size != 0 ||
+        header.size > SIZE_MAX / sizeof(T) || header.reserved[0] > SIZE_MAX) {
+        throw std::runtime_error("Повреждённый заголовок вектора");
+    }
+    Vector<char> staging;
+    staging.ResizeUninitialized(header.reserved[0]);
+    detail::ReadAll(fd, staging.begin(), staging.Size());
+    if (Fnv1aHash(staging.begin(), staging.Size()) != header.checksum) {
+        throw std::runtime_error("Повреждённое содержимое вектора");
+    }
+    Vector<T> result;
+    result.Reserve(header.size);
+    const char *cursor = staging.begin();
+    const char *end = staging.end();
+    for (uint64_t i = 0; i < header.size; ++i) {
+        result.EmplaceBack(decode(cursor, end));
+    }
+    if (cursor != end) {
+        throw std::runtime_error("Повреждённое содержимое вектора");
+    }
+    return result;
+}
+
+// Сохраняет вектор в файл: заголовок плюс один write всего буфера
+template<typename T, typename Allocator, typename GrowthPolicy,
+        ExceptionPolicy Policy>
+void SaveVectorTo(const Vector<T, Allocator, GrowthPolicy, Policy> &v,
+                  const std::string &path) {
+    int fd = ::open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Не удалось создать файл: " + path);
+    }
+    try {
+        WriteVectorTo(v, fd);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+    ::close(fd);
+}
+
+// Отображает сохранённый вектор: O(1) вместо поэлементной десериализации.
+// validate_checksum прогоняет контрольную сумму (и тем самым прогревает
+// страницы) — по умолчанию выключено ради мгновенного старта
+template<typename T>
+AdoptedVector<T> MapVectorFrom(const std::string &path,
+                               bool validate_checksum = false) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Персистентность поддерживается для тривиально копируемых T");
+    static_assert(alignof(T) <= sizeof(PersistentVectorHeader),
+                  "Слишком строгое выравнивание элемента");
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Не удалось открыть файл: " + path);
+    }
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) < sizeof(PersistentVectorHeader)) {
+        ::close(fd);
+        throw std::runtime_error("Файл вектора повреждён: " + path);
+    }
+    size_t file_size = static_cast<size_t>(st.st_size);
+    void *base = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        throw std::runtime_error("mmap не удался: " + path);
+    }
+
+    const auto *header = static_cast<const PersistentVectorHeader *>(base);
+    T *payload = reinterpret_cast<T *>(static_cast<char *>(base) +
+                                       sizeof(PersistentVectorHeader));
+    // Размер сверяется делением: header->size приходит из файла, и
+    // умножение на sizeof(T) могло бы переполниться на битом заголовке
+    bool valid = header->magic == PERSISTENT_VECTOR_MAGIC &&
+                 header->element_size == sizeof(T) &&
+                 header->size <=
+                         (file_size - sizeof(PersistentVectorHeader)) / sizeof(T);
+    if (valid && validate_checksum) {
+        valid = Fnv1aHash(payload, header->size * sizeof(T)) == header->checksum;
+    }
+    if (!valid) {
+        ::munmap(base, file_size);
+        throw std::runtime_error("Файл вектора повреждён: " + path);
+    }
+    return AdoptBuffer<T>(payload, header->size, header->size,
+                          UnmapVectorBuffer<T>);
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "vector.h"
+
+// Кольцевой буфер поверх RawMemory для FIFO-очередей между стадиями
+// конвейера. У Vector снятие головного элемента через Erase(begin())
+// сдвигает весь хвост — O(n) на каждый dequeue; здесь PopFront лишь
+// двигает индекс головы, PushBack — индекс хвоста, оба за O(1) без
+// переноса элементов. Содержимое лежит максимум двумя непрерывными
+// сегментами (до и после заворота), каждый доступен целиком через
+// Segments()
+template<typename T, typename Allocator = DefaultAllocator<T>,
+        typename GrowthPolicy = DoublingGrowth>
+class RingVector {
+public:
+    RingVector() = default;
+
+    explicit RingVector(Allocator alloc) : data_(std::move(alloc)) {}
+
+    explicit RingVector(size_t capacity, Allocator alloc = Allocator())
+            : data_(capacity, std::move(alloc)) {}
+
+    ~RingVector() { Clear(); }
+
+    RingVector(const RingVector &other)
+            : data_(other.size_, other.data_.GetAllocator()) {
+        size_t constructed = 0;
+        try {
+            for (; constructed < other.size_; ++constructed) {
+                std::construct_at(data_.GetAddress() + constructed,
+                                  other[constructed]);
+            }
+        } catch (...) {
+            std::destroy_n(data_.GetAddress(), constructed);
+            throw;
+        }
+        size_ = other.size_;
+    }
+
+    RingVector(RingVector &&other) noexcept { Swap(other); }
+
+    RingVector &operator=(const RingVector &rhs) {
+        if (this != &rhs) {
+            RingVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    RingVector &operator=(RingVector &&rhs) noexcept {
+        if (this != &rhs) {
+            Swap(rhs);
+        }
+        return *this;
+    }
+
+    void Swap(RingVector &other) noexcept {
+        data_.Swap(other.data_);
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= data_.Capacity()) {
+            return;
+        }
+        Relinearize(new_capacity);
+    }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&...args) {
+        if (size_ == data_.Capacity()) {
+            // Аргументы могут ссылаться на элементы самой очереди, поэтому
+            // новый элемент конструируется в новом буфере до пересадки —
+            // как в Vector::EmplaceBack
+            RawMemory<T, Allocator> new_data(
+                    GrowthPolicy::NextCapacity(data_.Capacity()),
+                    data_.GetAllocator());
+            std::construct_at(new_data + size_, std::forward<Args>(args)...);
+            try {
+                RelocateInto(new_data);
+            } catch (...) {
+                std::destroy_at(new_data + size_);
+                throw;
+            }
+            data_.Swap(new_data);
+            head_ = 0;
+            return data_[size_++];
+        }
+        T *slot = data_ + PhysicalIndex(size_);
+        std::construct_at(slot, std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    void PushBack(const T &value) { EmplaceBack(value); }
+
+    void PushBack(T &&value) { EmplaceBack(std::move(value)); }
+
+    // O(1): разрушает головной элемент и двигает индекс головы
+    void PopFront() noexcept {
+        assert(size_ > 0);
+        std::destroy_at(data_.GetAddress() + head_);
+        ++head_;
+        if (head_ == data_.Capacity()) {
+            head_ = 0;
+        }
+        --size_;
+    }
+
+    T &Front() noexcept {
+        assert(size_ > 0);
+        return data_[head_];
+    }
+
+    const T &Front() const noexcept {
+        return const_cast<RingVector &>(*this).Front();
+    }
+
+    T &Back() noexcept {
+        assert(size_ > 0);
+        return data_[PhysicalIndex(size_ - 1)];
+    }
+
+    const T &Back() const noexcept {
+        return const_cast<RingVector &>(*this).Back();
+    }
+
+    // Логический индекс: 0 — голова очереди
+    T &operator[](size_t index) noexcept {
+        assert(index < size_);
+        return data_[PhysicalIndex(index)];
+    }
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<RingVector &>(*this)[index];
+    }
+
+    size_t Size() const noexcept { return size_; }
+
+    size_t Capacity() const noexcept { return data_.Capacity(); }
+
+    bool IsEmpty() const noexcept { return size_ == 0; }
+
+    void Clear() noexcept {
+        auto [first, second] = Segments();
+        std::destroy_n(first.data, first.size);
+        std::destroy_n(second.data, second.size);
+        head_ = 0;
+        size_ = 0;
+    }
+
+    // Непрерывный кусок очереди; пригоден для блочных операций (memcpy,
+    // writev и т.п.)
+    struct Segment {
+        T *data;
+        size_t size;
+    };
+
+    // Содержимое в порядке очереди: первый сегмент от головы до конца
+    // буфера, второй — после заворота (пуст, пока очередь не завернулась)
+    std::pair<Segment, Segment> Segments() noexcept {
+        size_t first_len = std::min(size_, data_.Capacity() - head_);
+        return {{data_.GetAddress() + head_, first_len},
+                {data_.GetAddress(), size_ - first_len}};
+    }
+
+private:
+    size_t PhysicalIndex(size_t logical) const noexcept {
+        size_t index = head_ + logical;
+        if (index >= data_.Capacity()) {
+            index -= data_.Capacity();
+        }
+        return index;
+    }
+
+    // Переносит содержимое в new_data, выпрямляя очередь: голова снова в
+    // нулевой позиции. Выбор между memcpy, move и копиями — тот же, что у
+    // Vector при реаллокации; при исключении старый буфер не тронут
+    void RelocateInto(RawMemory<T, Allocator> &new_data) {
+        assert(new_data.Capacity() >= size_);
+        auto [first, second] = Segments();
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>) {
+            if (first.size != 0) {
+                std::memcpy(static_cast<void *>(new_data.GetAddress()),
+                            static_cast<const void *>(first.data),
+                            first.size * sizeof(T));
+            }
+            if (second.size != 0) {
+                std::memcpy(
+                        static_cast<void *>(new_data.GetAddress() + first.size),
+                        static_cast<const void *>(second.data),
+                        second.size * sizeof(T));
+            }
+        } else {
+            if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                          !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move_n(first.data, first.size,
+                                          new_data.GetAddress());
+                std::uninitialized_move_n(second.data, second.size,
+                                          new_data.GetAddress() + first.size);
+            } else {
+                std::uninitialized_copy_n(first.data, first.size,
+                                          new_data.GetAddress());
+                try {
+                    std::uninitialized_copy_n(second.data, second.size,
+                                              new_data.GetAddress() + first.size);
+                } catch (...) {
+                    std::destroy_n(new_data.GetAddress(), first.size);
+                    throw;
+                }
+            }
+            std::destroy_n(first.data, first.size);
+            std::destroy_n(second.data, second.size);
+        }
+    }
+
+    void Relinearize(size_t new_capacity) {
+        assert(new_capacity >= size_);
+        RawMemory<T, Allocator> new_data(new_capacity, data_.GetAllocator());
+        RelocateInto(new_data);
+        data_.Swap(new_data);
+        head_ = 0;
+    }
+
+    RawMemory<T, Allocator> data_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+};
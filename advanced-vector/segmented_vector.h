@@ -0,0 +1,220 @@
+#pragma once
+
+#include "vector.h"
+
+// Сегментированное хранилище для append-only журналов: элементы лежат в
+// цепочке кусков фиксированного размера, и рост — это выделение одного
+// нового куска за O(1). Ни реаллокаций содержимого, ни 200-мс пауз на
+// перенос многогигабайтного буфера, ни временного двойного футпринта;
+// адреса элементов стабильны на всю жизнь контейнера. Плата — отсутствие
+// сплошной непрерывности: доступ по индексу стоит одно деление на
+// константу (при степени двойки — сдвиг и маску)
+template<typename T, size_t ChunkCapacity = 1024,
+        typename Allocator = DefaultAllocator<T>>
+class SegmentedVector {
+    static_assert(ChunkCapacity > 0);
+
+public:
+    SegmentedVector() = default;
+
+    explicit SegmentedVector(Allocator alloc) : alloc_(std::move(alloc)) {}
+
+    ~SegmentedVector() { DestroyAll(); }
+
+    SegmentedVector(const SegmentedVector &other) : alloc_(other.alloc_) {
+        try {
+            for (size_t i = 0; i < other.size_; ++i) {
+                EmplaceBack(other[i]);
+            }
+        } catch (...) {
+            DestroyAll();
+            throw;
+        }
+    }
+
+    SegmentedVector(SegmentedVector &&other) noexcept { Swap(other); }
+
+    SegmentedVector &operator=(const SegmentedVector &rhs) {
+        if (this != &rhs) {
+            SegmentedVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    SegmentedVector &operator=(SegmentedVector &&rhs) noexcept {
+        if (this != &rhs) {
+            Swap(rhs);
+        }
+        return *this;
+    }
+
+    void Swap(SegmentedVector &other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        chunks_.Swap(other.chunks_);
+        std::swap(size_, other.size_);
+    }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&...args) {
+        size_t chunk = size_ / ChunkCapacity;
+        size_t offset = size_ % ChunkCapacity;
+        if (offset == 0 && chunk == chunks_.Size()) {
+            // Рост: один новый кусок, существующие элементы не трогаются
+            chunks_.EmplaceBack(ChunkCapacity, alloc_);
+        }
+        T *slot = chunks_[chunk] + offset;
+        std::construct_at(slot, std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    void PushBack(const T &value) { EmplaceBack(value); }
+
+    void PushBack(T &&value) { EmplaceBack(std::move(value)); }
+
+    // Кусок остаётся выделенным под будущие PushBack
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        --size_;
+        std::destroy_at(chunks_[size_ / ChunkCapacity] + size_ % ChunkCapacity);
+    }
+
+    // Разрушает элементы, сохраняя выделенные куски
+    void Clear() noexcept {
+        for (size_t chunk = 0; size_ != 0; ++chunk) {
+            size_t count = std::min(size_, ChunkCapacity);
+            std::destroy_n(chunks_[chunk].GetAddress(), count);
+            size_ -= count;
+        }
+    }
+
+    size_t Size() const noexcept { return size_; }
+
+    size_t Capacity() const noexcept { return chunks_.Size() * ChunkCapacity; }
+
+    bool IsEmpty() const noexcept { return size_ == 0; }
+
+    T &operator[](size_t index) noexcept {
+        assert(index < size_);
+        return chunks_[index / ChunkCapacity][index % ChunkCapacity];
+    }
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<SegmentedVector &>(*this)[index];
+    }
+
+    // Итератор по логическому индексу: произвольный доступ поверх кусков
+    template<bool IsConst>
+    class BasicIterator {
+        using Owner = std::conditional_t<IsConst, const SegmentedVector,
+                SegmentedVector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        BasicIterator() = default;
+
+        BasicIterator(Owner *owner, size_t index)
+                : owner_(owner), index_(index) {}
+
+        reference operator*() const noexcept { return (*owner_)[index_]; }
+
+        pointer operator->() const noexcept { return &(*owner_)[index_]; }
+
+        reference operator[](difference_type n) const noexcept {
+            return (*owner_)[index_ + n];
+        }
+
+        BasicIterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        BasicIterator &operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        BasicIterator &operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        BasicIterator &operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it,
+                                       difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend BasicIterator operator+(difference_type n,
+                                       BasicIterator it) noexcept {
+            return it += n;
+        }
+
+        friend BasicIterator operator-(BasicIterator it,
+                                       difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const BasicIterator &lhs,
+                                         const BasicIterator &rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) -
+                   static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator &,
+                               const BasicIterator &) = default;
+
+        friend auto operator<=>(const BasicIterator &lhs,
+                                const BasicIterator &rhs) noexcept {
+            return lhs.index_ <=> rhs.index_;
+        }
+
+    private:
+        Owner *owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    iterator begin() noexcept { return iterator(this, 0); }
+
+    iterator end() noexcept { return iterator(this, size_); }
+
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    const_iterator cend() const noexcept { return end(); }
+
+private:
+    void DestroyAll() noexcept { Clear(); }
+
+    Allocator alloc_{};
+    Vector<RawMemory<T, Allocator>> chunks_;
+    size_t size_ = 0;
+};
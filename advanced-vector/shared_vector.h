@@ -0,0 +1,65 @@
+#pragma once
+
+#include "vector.h"
+
+#include <atomic>
+#include <memory>
+
+// Неизменяемый снимок вектора, разделяемый через подсчёт ссылок: копия
+// SharedVector — это инкремент счётчика, а не O(n) глубокая копия.
+// Снимок строится один раз кражей буфера из Vector (или одной глубокой
+// копией, если исходник ещё нужен), дальше читатели делят общий буфер
+template<typename T>
+class SharedVector {
+public:
+    SharedVector() = default;
+
+    // Крадёт буфер source без копирования элементов
+    explicit SharedVector(Vector<T> &&source)
+            : data_(std::make_shared<const Vector<T>>(std::move(source))) {}
+
+    // Единственная глубокая копия — дальше только разделение
+    explicit SharedVector(const Vector<T> &source)
+            : data_(std::make_shared<const Vector<T>>(source)) {}
+
+    size_t Size() const noexcept { return data_ == nullptr ? 0 : data_->Size(); }
+
+    const T &operator[](size_t index) const noexcept { return (*data_)[index]; }
+
+    using const_iterator = const T *;
+
+    const_iterator begin() const noexcept {
+        return data_ == nullptr ? nullptr : data_->begin();
+    }
+
+    const_iterator end() const noexcept {
+        return data_ == nullptr ? nullptr : data_->end();
+    }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    const_iterator cend() const noexcept { return end(); }
+
+private:
+    std::shared_ptr<const Vector<T>> data_;
+};
+
+// Точка раздачи снимков читателям: Publish атомарно подменяет текущий
+// снимок, Load атомарно берёт актуальный. Обновление конфигурации из
+// O(n)-копии на каждого потребителя превращается в один обмен указателя
+template<typename T>
+class SharedVectorPublisher {
+public:
+    void Publish(Vector<T> &&data) {
+        current_.store(
+                std::make_shared<const SharedVector<T>>(std::move(data)));
+    }
+
+    SharedVector<T> Load() const {
+        std::shared_ptr<const SharedVector<T>> snapshot = current_.load();
+        return snapshot == nullptr ? SharedVector<T>() : *snapshot;
+    }
+
+private:
+    std::atomic<std::shared_ptr<const SharedVector<T>>> current_;
+};
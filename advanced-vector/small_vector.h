@@ -0,0 +1,183 @@
+#pragma once
+
+#include "vector.h"
+
+// Вектор с буфером малого размера: первые InlineCapacity элементов хранятся
+// прямо в объекте без обращения к куче, при переполнении содержимое
+// переезжает в обычный RawMemory. Перенос использует ту же стратегию
+// move/copy/memcpy, что и Vector
+template<typename T, size_t InlineCapacity,
+        typename Allocator = DefaultAllocator<T>>
+class SmallVector {
+    static_assert(InlineCapacity > 0,
+                  "При нулевом встроенном буфере используйте Vector");
+
+public:
+    SmallVector() = default;
+
+    explicit SmallVector(size_t size) {
+        Reserve(size);
+        std::uninitialized_value_construct_n(Data(), size);
+        size_ = size;
+    }
+
+    ~SmallVector() { std::destroy_n(Data(), size_); }
+
+    SmallVector(const SmallVector &other) {
+        Reserve(other.size_);
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+    }
+
+    SmallVector(SmallVector &&other) noexcept(
+            std::is_nothrow_move_constructible_v<T>) {
+        TakeContentsFrom(std::move(other));
+    }
+
+    SmallVector &operator=(const SmallVector &rhs) {
+        if (this != &rhs) {
+            SmallVector rhs_copy(rhs);
+            *this = std::move(rhs_copy);
+        }
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&rhs) noexcept(
+            std::is_nothrow_move_constructible_v<T>) {
+        if (this != &rhs) {
+            std::destroy_n(Data(), size_);
+            size_ = 0;
+            TakeContentsFrom(std::move(rhs));
+        }
+        return *this;
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        RawMemory<T, Allocator> new_data(new_capacity);
+        RelocateInto(Data(), size_, new_data.GetAddress());
+        data_ = std::move(new_data);
+        spilled_ = true;
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size <= size_) {
+            std::destroy_n(Data() + new_size, size_ - new_size);
+        } else {
+            Reserve(new_size);
+            std::uninitialized_value_construct_n(Data() + size_,
+                                                 new_size - size_);
+        }
+        size_ = new_size;
+    }
+
+    void PushBack(const T &value) { EmplaceBack(value); }
+
+    void PushBack(T &&value) { EmplaceBack(std::move(value)); }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&...args) {
+        if (size_ == Capacity()) {
+            RawMemory<T, Allocator> new_data(size_ * 2);
+            new(new_data + size_) T(std::forward<Args>(args)...);
+            RelocateInto(Data(), size_, new_data.GetAddress());
+            data_ = std::move(new_data);
+            spilled_ = true;
+        } else {
+            new(Data() + size_) T(std::forward<Args>(args)...);
+        }
+        return *(Data() + size_++);
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        std::destroy_n(Data() + --size_, 1);
+    }
+
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    iterator begin() noexcept { return Data(); }
+
+    iterator end() noexcept { return Data() + size_; }
+
+    const_iterator begin() const noexcept { return Data(); }
+
+    const_iterator end() const noexcept { return Data() + size_; }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    const_iterator cend() const noexcept { return end(); }
+
+    size_t Size() const noexcept { return size_; }
+
+    size_t Capacity() const noexcept {
+        return spilled_ ? data_.Capacity() : InlineCapacity;
+    }
+
+    // true, пока элементы лежат во встроенном буфере без кучи
+    bool IsInline() const noexcept { return !spilled_; }
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<SmallVector &>(*this)[index];
+    }
+
+    T &operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+private:
+    T *Data() noexcept {
+        return spilled_ ? data_.GetAddress()
+                        : reinterpret_cast<T *>(inline_buffer_);
+    }
+
+    const T *Data() const noexcept {
+        return const_cast<SmallVector &>(*this).Data();
+    }
+
+    // Та же стратегия переноса, что и в Vector::MoveOrCopyDataAndReplace:
+    // релоцируемые типы — один memcpy без прохода деструкторов, остальные —
+    // move/copy с последующим разрушением исходных элементов
+    static void RelocateInto(T *from, size_t count, T *to) {
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>) {
+            if (count != 0) {
+                std::memcpy(static_cast<void *>(to),
+                            static_cast<const void *>(from), count * sizeof(T));
+            }
+        } else {
+            if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                          !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move_n(from, count, to);
+            } else {
+                std::uninitialized_copy_n(from, count, to);
+            }
+            std::destroy_n(from, count);
+        }
+    }
+
+    // Забирает содержимое other, оставляя его пустым: спилленный буфер
+    // крадётся целиком, встроенный переносится поэлементно
+    void TakeContentsFrom(SmallVector &&other) {
+        assert(size_ == 0);
+        if (other.spilled_) {
+            data_ = std::move(other.data_);
+            spilled_ = true;
+            size_ = other.size_;
+        } else {
+            Reserve(other.size_);
+            RelocateInto(other.Data(), other.size_, Data());
+            size_ = other.size_;
+        }
+        other.spilled_ = false;
+        other.size_ = 0;
+    }
+
+    alignas(T) unsigned char inline_buffer_[InlineCapacity * sizeof(T)];
+    RawMemory<T, Allocator> data_;
+    size_t size_ = 0;
+    bool spilled_ = false;
+};
@@ -0,0 +1,292 @@
+#pragma once
+
+#include "vector.h"
+
+#include <tuple>
+
+// Колоночное (structure-of-arrays) хранилище: строка {K, V, F} раскладывается
+// по отдельным плотным буферам RawMemory<K>, RawMemory<V>, RawMemory<F>.
+// Скан одного поля читает память последовательно, не таща в кэш соседние
+// поля строки. Интерфейс повторяет Vector: Reserve/Resize/EmplaceBack/
+// PopBack, рост релоцирует все колонки в рамках одной реаллокации
+template<typename... Ts>
+class SoAVector {
+    static_assert(sizeof...(Ts) > 0, "Нужна хотя бы одна колонка");
+
+    static constexpr size_t NUM_COLUMNS = sizeof...(Ts);
+
+public:
+    SoAVector() = default;
+
+    explicit SoAVector(size_t size) {
+        Reserve(size);
+        ConstructTails(0, size);
+        size_ = size;
+    }
+
+    ~SoAVector() { DestroyTails(0, size_); }
+
+    SoAVector(const SoAVector &other) {
+        Reserve(other.size_);
+        CopyColumnsFrom<0>(other, other.size_);
+        size_ = other.size_;
+    }
+
+    SoAVector(SoAVector &&other) noexcept { Swap(other); }
+
+    SoAVector &operator=(const SoAVector &rhs) {
+        if (this != &rhs) {
+            SoAVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    SoAVector &operator=(SoAVector &&rhs) noexcept {
+        if (this != &rhs) {
+            Swap(rhs);
+        }
+        return *this;
+    }
+
+    void Swap(SoAVector &other) noexcept {
+        SwapColumns(other, std::index_sequence_for<Ts...>{});
+        std::swap(size_, other.size_);
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        ReplaceColumns(new_capacity);
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size <= size_) {
+            DestroyTails(new_size, size_ - new_size);
+        } else {
+            Reserve(new_size);
+            ConstructTails(size_, new_size - size_);
+        }
+        size_ = new_size;
+    }
+
+    // Добавляет строку: по одному значению на колонку
+    template<typename... Us>
+    void EmplaceBack(Us &&...values) {
+        static_assert(sizeof...(Us) == NUM_COLUMNS,
+                      "Значений должно быть по числу колонок");
+        if (size_ == Capacity()) {
+            // Значения могут ссылаться на ячейки самих колонок, поэтому
+            // строка материализуется до пересадки буферов
+            std::tuple<Ts...> row(std::forward<Us>(values)...);
+            Reserve(size_ == 0 ? 1 : size_ * 2);
+            ConstructRowFromTuple(std::move(row),
+                                  std::index_sequence_for<Ts...>{});
+        } else {
+            ConstructRow<0>(std::forward<Us>(values)...);
+        }
+        ++size_;
+    }
+
+    template<typename... Us>
+    void PushBack(Us &&...values) {
+        EmplaceBack(std::forward<Us>(values)...);
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        --size_;
+        DestroyTails(size_, 1);
+    }
+
+    size_t Size() const noexcept { return size_; }
+
+    size_t Capacity() const noexcept { return std::get<0>(columns_).Capacity(); }
+
+    // Плотный буфер I-й колонки: [ColumnBegin, ColumnEnd) — последовательный
+    // диапазон для сканов и автовекторизации
+    template<size_t I>
+    auto *ColumnBegin() noexcept {
+        return std::get<I>(columns_).GetAddress();
+    }
+
+    template<size_t I>
+    const auto *ColumnBegin() const noexcept {
+        return std::get<I>(columns_).GetAddress();
+    }
+
+    template<size_t I>
+    auto *ColumnEnd() noexcept {
+        return std::get<I>(columns_).GetAddress() + size_;
+    }
+
+    template<size_t I>
+    const auto *ColumnEnd() const noexcept {
+        return std::get<I>(columns_).GetAddress() + size_;
+    }
+
+    // Значение I-й колонки в строке index
+    template<size_t I>
+    auto &Get(size_t index) noexcept {
+        assert(index < size_);
+        return std::get<I>(columns_)[index];
+    }
+
+    template<size_t I>
+    const auto &Get(size_t index) const noexcept {
+        assert(index < size_);
+        return std::get<I>(columns_)[index];
+    }
+
+    // Вся строка как кортеж ссылок
+    std::tuple<Ts &...> Row(size_t index) noexcept {
+        assert(index < size_);
+        return RowImpl(index, std::index_sequence_for<Ts...>{});
+    }
+
+    std::tuple<const Ts &...> Row(size_t index) const noexcept {
+        assert(index < size_);
+        return const_cast<SoAVector &>(*this).RowImpl(
+                index, std::index_sequence_for<Ts...>{});
+    }
+
+private:
+    template<size_t... Is>
+    void SwapColumns(SoAVector &other, std::index_sequence<Is...>) noexcept {
+        (std::get<Is>(columns_).Swap(std::get<Is>(other.columns_)), ...);
+    }
+
+    template<size_t... Is>
+    std::tuple<Ts &...> RowImpl(size_t index, std::index_sequence<Is...>) {
+        return std::tie(std::get<Is>(columns_)[index]...);
+    }
+
+    // Заполняет новый буфер одной колонки — та же стратегия, что и у
+    // Vector. Исходные элементы не разрушаются: это делает CommitColumns,
+    // когда перенесены все колонки
+    template<typename T>
+    static void FillColumn(T *from, size_t count, T *to) {
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>) {
+            if (count != 0) {
+                std::memcpy(static_cast<void *>(to),
+                            static_cast<const void *>(from), count * sizeof(T));
+            }
+        } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                             !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(from, count, to);
+        } else {
+            std::uninitialized_copy_n(from, count, to);
+        }
+    }
+
+    // Откат заполненного буфера колонки: memcpy-релоцированными байтами
+    // по-прежнему владеют исходные элементы, разрушать нечего
+    template<typename T>
+    static void DiscardFilled(T *to, size_t count) noexcept {
+        if constexpr (!IS_TRIVIALLY_RELOCATABLE<T>) {
+            std::destroy_n(to, count);
+        }
+    }
+
+    template<size_t I>
+    void FillColumns(std::tuple<RawMemory<Ts>...> &new_columns) {
+        if constexpr (I < NUM_COLUMNS) {
+            auto *to = std::get<I>(new_columns).GetAddress();
+            FillColumn(std::get<I>(columns_).GetAddress(), size_, to);
+            try {
+                FillColumns<I + 1>(new_columns);
+            } catch (...) {
+                DiscardFilled(to, size_);
+                throw;
+            }
+        }
+    }
+
+    // Безоткатная фаза: разрушает исходные элементы (кроме колонок,
+    // релоцированных memcpy, — их объекты уже живут в новых буферах) и
+    // обменивает буферы всех колонок разом
+    template<size_t... Is>
+    void CommitColumns(std::tuple<RawMemory<Ts>...> &new_columns,
+                       std::index_sequence<Is...>) noexcept {
+        auto retire = []<typename T>(T *from, size_t count) {
+            if constexpr (!IS_TRIVIALLY_RELOCATABLE<T>) {
+                std::destroy_n(from, count);
+            }
+        };
+        (retire(std::get<Is>(columns_).GetAddress(), size_), ...);
+        (std::get<Is>(columns_).Swap(std::get<Is>(new_columns)), ...);
+    }
+
+    // Переводит все колонки на буферы новой ёмкости — одно событие роста
+    // на все колонки сразу. Сначала выделяются все новые буферы, затем
+    // переносятся данные и только в конце колонки обмениваются: исключение
+    // в аллокации или копировании любой из колонок оставляет ёмкости и
+    // содержимое всех колонок нетронутыми
+    void ReplaceColumns(size_t new_capacity) {
+        std::tuple<RawMemory<Ts>...> new_columns{RawMemory<Ts>(new_capacity)...};
+        FillColumns<0>(new_columns);
+        CommitColumns(new_columns, std::index_sequence_for<Ts...>{});
+    }
+
+    template<typename Tuple, size_t... Is>
+    void ConstructRowFromTuple(Tuple &&row, std::index_sequence<Is...>) {
+        ConstructRow<0>(std::move(std::get<Is>(row))...);
+    }
+
+    // Конструирует значения одной строки по колонкам; при исключении
+    // разрушает уже заполненные ячейки строки
+    template<size_t I, typename U, typename... Us>
+    void ConstructRow(U &&value, Us &&...rest) {
+        auto *cell = std::get<I>(columns_).GetAddress() + size_;
+        new(cell) std::remove_reference_t<decltype(*cell)>(std::forward<U>(value));
+        if constexpr (sizeof...(Us) > 0) {
+            try {
+                ConstructRow<I + 1>(std::forward<Us>(rest)...);
+            } catch (...) {
+                std::destroy_at(cell);
+                throw;
+            }
+        }
+    }
+
+    template<size_t I = 0>
+    void ConstructTails(size_t from, size_t count) {
+        if constexpr (I < NUM_COLUMNS) {
+            auto *first = std::get<I>(columns_).GetAddress() + from;
+            std::uninitialized_value_construct_n(first, count);
+            try {
+                ConstructTails<I + 1>(from, count);
+            } catch (...) {
+                std::destroy_n(first, count);
+                throw;
+            }
+        }
+    }
+
+    template<size_t I = 0>
+    void DestroyTails(size_t from, size_t count) noexcept {
+        if constexpr (I < NUM_COLUMNS) {
+            std::destroy_n(std::get<I>(columns_).GetAddress() + from, count);
+            DestroyTails<I + 1>(from, count);
+        }
+    }
+
+    template<size_t I>
+    void CopyColumnsFrom(const SoAVector &other, size_t count) {
+        if constexpr (I < NUM_COLUMNS) {
+            auto *first = std::get<I>(columns_).GetAddress();
+            std::uninitialized_copy_n(std::get<I>(other.columns_).GetAddress(),
+                                      count, first);
+            try {
+                CopyColumnsFrom<I + 1>(other, count);
+            } catch (...) {
+                std::destroy_n(first, count);
+                throw;
+            }
+        }
+    }
+
+    std::tuple<RawMemory<Ts>...> columns_;
+    size_t size_ = 0;
+};
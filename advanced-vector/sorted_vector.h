@@ -0,0 +1,110 @@
+#pragma once
+
+#include "vector.h"
+
+#include <functional>
+
+// Плоский сортированный индекс поверх Vector. Одиночная вставка через
+// upper_bound + Insert сдвигает хвост на каждый ключ — O(K*n) переносов
+// на пачку из K ключей; здесь новые значения копятся в небольшом
+// несортированном хвосте буфера и вливаются в основную часть одним
+// слиянием: O(n + K log K). Поиск — бинарный, без непредсказуемых
+// переходов. Элементы доступны только на чтение: запись сломала бы
+// инвариант сортированности
+template<typename T, typename Compare = std::less<T>,
+        typename Allocator = DefaultAllocator<T>,
+        typename GrowthPolicy = DoublingGrowth>
+class SortedVector {
+public:
+    SortedVector() = default;
+
+    explicit SortedVector(Compare cmp) : cmp_(std::move(cmp)) {}
+
+    void Reserve(size_t new_capacity) { data_.Reserve(new_capacity); }
+
+    // Одиночная вставка: значение попадает в несортированный хвост и
+    // вливается отложенно, когда хвост вырастает или нужен поиск
+    void Insert(T value) {
+        data_.PushBack(std::move(value));
+        if (++tail_size_ > MAX_TAIL) {
+            Flush();
+        }
+    }
+
+    // Пакетная вставка: вся пачка дописывается в хвост и вливается одним
+    // слиянием вместо K сдвигов хвоста
+    template<typename InputIt>
+    void InsertBatch(InputIt first, InputIt last) {
+        size_t old_size = data_.Size();
+        data_.AppendRange(first, last);
+        tail_size_ += data_.Size() - old_size;
+        Flush();
+    }
+
+    // Вливает несортированный хвост: сортировка K элементов плюс один
+    // слияющий проход по буферу
+    void Flush() {
+        if (tail_size_ == 0) {
+            return;
+        }
+        T *middle = data_.end() - tail_size_;
+        std::sort(middle, data_.end(), cmp_);
+        std::inplace_merge(data_.begin(), middle, data_.end(), cmp_);
+        tail_size_ = 0;
+    }
+
+    // Первая позиция, куда можно вставить value без нарушения порядка.
+    // Окно поиска делится пополам, выбор половины — условным смещением
+    // базы (cmov) вместо непредсказуемого перехода
+    const T *LowerBound(const T &value) {
+        Flush();
+        const T *base = data_.begin();
+        size_t n = data_.Size();
+        while (n > 1) {
+            size_t half = n / 2;
+            base = cmp_(base[half - 1], value) ? base + half : base;
+            n -= half;
+        }
+        if (n == 1 && cmp_(base[0], value)) {
+            ++base;
+        }
+        return base;
+    }
+
+    const T *Find(const T &value) {
+        const T *it = LowerBound(value);
+        return it != end() && !cmp_(value, *it) ? it : end();
+    }
+
+    bool Contains(const T &value) { return Find(value) != end(); }
+
+    size_t Size() const noexcept { return data_.Size(); }
+
+    bool IsEmpty() const noexcept { return data_.Size() == 0; }
+
+    const T &operator[](size_t index) {
+        Flush();
+        return data_[index];
+    }
+
+    using const_iterator = const T *;
+
+    const_iterator begin() {
+        Flush();
+        return data_.begin();
+    }
+
+    const_iterator end() {
+        Flush();
+        return data_.end();
+    }
+
+private:
+    // Порог ленивого слияния: одиночные вставки амортизируются пачками
+    // этого размера
+    static constexpr size_t MAX_TAIL = 64;
+
+    Vector<T, Allocator, GrowthPolicy> data_;
+    size_t tail_size_ = 0;
+    Compare cmp_{};
+};
@@ -1,99 +1,376 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <concepts>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <new>
+#include <thread>
+#include <type_traits>
 #include <utility>
 
+// Тип тривиально релоцируем, если move-конструктор плюс деструктор
+// исходного объекта эквивалентны побайтовому переносу. Для тривиально
+// копируемых типов это верно автоматически; для своих типов (хэндлы,
+// указатели на внешние ресурсы без самоссылок) трейт можно
+// специализировать вручную
 template<typename T>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+template<typename T>
+inline constexpr bool IS_TRIVIALLY_RELOCATABLE = IsTriviallyRelocatable<T>::value;
+
+// Опциональная телеметрия роста векторов. Включается определением
+// ADVANCED_VECTOR_STATS до включения заголовка; без него хуки пустые и
+// кода не генерируют. Счётчики потоко-локальные, чтобы не тормозить
+// горячий путь атомарными инкрементами, — экспортёр агрегирует их сам
+#ifdef ADVANCED_VECTOR_STATS
+
+struct VectorStats {
+    size_t num_reallocations = 0;   // рост буфера, включая расширение на месте
+    size_t bytes_moved = 0;         // байты, перенесённые между буферами
+    size_t peak_capacity_bytes = 0; // максимальная ёмкость одного вектора
+    size_t wasted_bytes = 0;        // слабина (capacity - size) в моменты роста
+
+    void Reset() { *this = VectorStats{}; }
+};
+
+// Счётчики текущего потока
+inline VectorStats &ThreadVectorStats() {
+    thread_local VectorStats stats;
+    return stats;
+}
+
+// Колбэк, вызываемый на каждой реаллокации: размер элемента, старая и
+// новая ёмкость, число живых элементов. Устанавливается один раз на
+// старте процесса, до создания рабочих потоков
+using ReallocationCallback = void (*)(size_t element_size, size_t old_capacity,
+                                      size_t new_capacity, size_t size);
+
+inline ReallocationCallback &ReallocationCallbackRef() {
+    static ReallocationCallback callback = nullptr;
+    return callback;
+}
+
+inline void SetReallocationCallback(ReallocationCallback callback) {
+    ReallocationCallbackRef() = callback;
+}
+
+#endif // ADVANCED_VECTOR_STATS
+
+// Аллокатор по умолчанию: поведение, которое RawMemory имел всегда.
+// Тривиально релоцируемые типы обслуживаются через malloc/realloc/free,
+// остальные — через operator new/delete
+template<typename T>
+struct DefaultAllocator {
+    constexpr T *Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        if (std::is_constant_evaluated()) {
+            // Константные вычисления: единственный разрешённый источник
+            // памяти — std::allocator
+            return std::allocator<T>().allocate(n);
+        }
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>) {
+            T *buf = static_cast<T *>(std::malloc(n * sizeof(T)));
+            if (buf == nullptr) {
+                throw std::bad_alloc();
+            }
+            return buf;
+        } else {
+            return static_cast<T *>(operator new(n * sizeof(T)));
+        }
+    }
+
+    constexpr void Deallocate(T *buf, size_t n) noexcept {
+        if (std::is_constant_evaluated()) {
+            if (buf != nullptr) {
+                std::allocator<T>().deallocate(buf, n);
+            }
+            return;
+        }
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>) {
+            std::free(buf);
+        } else {
+            operator delete(buf);
+        }
+    }
+
+    // Расширяет блок на месте (или силами realloc), возможно только для
+    // тривиально релоцируемых типов
+    bool TryExtend(T *&buf, size_t /*old_n*/, size_t new_n) {
+        static_assert(IS_TRIVIALLY_RELOCATABLE<T>);
+        T *new_buf = static_cast<T *>(std::realloc(buf, new_n * sizeof(T)));
+        if (new_buf == nullptr) {
+            return false;
+        }
+        buf = new_buf;
+        return true;
+    }
+};
+
+template<typename T, typename Allocator = DefaultAllocator<T>>
 class RawMemory {
 public:
-    RawMemory() = default;
+    constexpr RawMemory() = default;
 
-    explicit RawMemory(size_t capacity)
-            : buffer_(Allocate(capacity)), capacity_(capacity) {}
+    constexpr explicit RawMemory(Allocator alloc) : alloc_(std::move(alloc)) {}
 
-    ~RawMemory() { Deallocate(buffer_); }
+    constexpr explicit RawMemory(size_t capacity, Allocator alloc = Allocator())
+            : alloc_(std::move(alloc)), buffer_(alloc_.Allocate(capacity)),
+              capacity_(capacity) {}
+
+    constexpr ~RawMemory() { alloc_.Deallocate(buffer_, capacity_); }
 
     RawMemory(const RawMemory &) = delete;
 
     RawMemory &operator=(const RawMemory &rhs) = delete;
 
-    RawMemory(RawMemory &&other) noexcept { Swap(other); }
+    constexpr RawMemory(RawMemory &&other) noexcept { Swap(other); }
 
-    RawMemory &operator=(RawMemory &&rhs) noexcept {
+    constexpr RawMemory &operator=(RawMemory &&rhs) noexcept {
         if (this != &rhs) {
-            Deallocate(buffer_);
+            alloc_.Deallocate(buffer_, capacity_);
+            buffer_ = nullptr;
+            capacity_ = 0;
             Swap(rhs);
         }
         return *this;
     }
 
-    T *operator+(size_t offset) noexcept {
+    constexpr T *operator+(size_t offset) noexcept {
         // Разрешается получать адрес ячейки памяти, следующей за последним
         // элементом массива
         assert(offset <= capacity_);
         return buffer_ + offset;
     }
 
-    const T *operator+(size_t offset) const noexcept {
+    constexpr const T *operator+(size_t offset) const noexcept {
         return const_cast<RawMemory &>(*this) + offset;
     }
 
-    const T &operator[](size_t index) const noexcept {
+    constexpr const T &operator[](size_t index) const noexcept {
         return const_cast<RawMemory &>(*this)[index];
     }
 
-    T &operator[](size_t index) noexcept {
+    constexpr T &operator[](size_t index) noexcept {
         assert(index < capacity_);
         return buffer_[index];
     }
 
-    void Swap(RawMemory &other) noexcept {
+    constexpr void Swap(RawMemory &other) noexcept {
+        std::swap(alloc_, other.alloc_);
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
     }
 
-    const T *GetAddress() const noexcept { return buffer_; }
+    constexpr const T *GetAddress() const noexcept { return buffer_; }
 
-    T *GetAddress() noexcept { return buffer_; }
+    constexpr T *GetAddress() noexcept { return buffer_; }
 
-    size_t Capacity() const { return capacity_; }
+    constexpr size_t Capacity() const { return capacity_; }
 
-private:
-    // Выделяет сырую память под n элементов и возвращает указатель на неё
-    static T *Allocate(size_t n) {
-        return n != 0 ? static_cast<T *>(operator new(n * sizeof(T))) : nullptr;
+    constexpr const Allocator &GetAllocator() const noexcept { return alloc_; }
+
+    // Принимает во владение внешний буфер; освобождать его будет аллокатор
+    // этого RawMemory
+    void AdoptBuffer(T *buffer, size_t capacity) noexcept {
+        assert(buffer_ == nullptr);
+        buffer_ = buffer;
+        capacity_ = capacity;
     }
 
-    // Освобождает сырую память, выделенную ранее по адресу buf при помощи Allocate
-    static void Deallocate(T *buf) noexcept { operator delete(buf); }
+    // Отдаёт буфер вызывающему: память больше не принадлежит RawMemory
+    T *ReleaseBuffer() noexcept {
+        T *buffer = buffer_;
+        buffer_ = nullptr;
+        capacity_ = 0;
+        return buffer;
+    }
 
+    // Пытается расширить буфер до new_capacity без переноса элементов силами
+    // Vector. Доступно только для тривиально релоцируемых типов и аллокаторов,
+    // умеющих расширять блок (TryExtend); realloc сам переносит байты, если
+    // не смог расширить блок на месте
+    constexpr bool TryExtend(size_t new_capacity) {
+        static_assert(IS_TRIVIALLY_RELOCATABLE<T>);
+        if (new_capacity <= capacity_) {
+            return true;
+        }
+        if (std::is_constant_evaluated()) {
+            return false;
+        }
+        if constexpr (requires(Allocator a, T *&p) {
+                          { a.TryExtend(p, size_t{}, size_t{}) } -> std::same_as<bool>;
+                      }) {
+            if (buffer_ != nullptr &&
+                alloc_.TryExtend(buffer_, capacity_, new_capacity)) {
+                capacity_ = new_capacity;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    Allocator alloc_{};
     T *buffer_ = nullptr;
     size_t capacity_ = 0;
 };
 
-template<typename T>
+// Политики роста ёмкости. Политика — тип со статической функцией
+// NextCapacity(current), возвращающей ёмкость после переполнения
+
+// Классическое удвоение: минимум реаллокаций, до 50% незанятой памяти
+struct DoublingGrowth {
+    static constexpr size_t NextCapacity(size_t current) {
+        return current == 0 ? 1 : current * 2;
+    }
+};
+
+// Рост в полтора раза: больше реаллокаций, но заметно меньше слабины
+// в установившемся режиме у долгоживущих векторов
+struct GrowthOneAndHalf {
+    static constexpr size_t NextCapacity(size_t current) {
+        return current < 2 ? current + 1 : current + current / 2;
+    }
+};
+
+// Политика поведения при исключениях во время реаллокации.
+// Strong — классическая строгая гарантия: если move-конструктор T может
+// бросить, элементы при переносе копируются, чтобы исключение оставило
+// старый буфер невредимым. Terminate — элементы всегда перемещаются, а
+// исключение из move-конструктора приводит к std::terminate. Режим для
+// сборок с -fno-exceptions и для сторонних типов без noexcept-аннотаций,
+// где глубокие копии страхуют от отказа, которого не бывает
+enum class ExceptionPolicy {
+    Strong,
+    Terminate,
+};
+
+// true, если по итераторам можно заранее вычислить длину диапазона
+template<typename It>
+inline constexpr bool IS_FORWARD_ITERATOR = std::is_base_of_v<
+        std::forward_iterator_tag,
+        typename std::iterator_traits<It>::iterator_category>;
+
+namespace detail {
+
+    // constexpr-эквиваленты uninitialized_*-алгоритмов: при константных
+    // вычислениях элементы строятся через std::construct_at (placement new в
+    // constexpr недоступен, а сами алгоритмы в C++20 не constexpr), в
+    // рантайме — делегирование обычным алгоритмам с их гарантиями отката
+    template<typename T>
+    constexpr void UninitializedValueConstructN(T *first, size_t count) {
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i != count; ++i) {
+                std::construct_at(first + i);
+            }
+        } else {
+            std::uninitialized_value_construct_n(first, count);
+        }
+    }
+
+    template<typename InputIt, typename T>
+    constexpr void UninitializedCopy(InputIt first, InputIt last, T *out) {
+        if (std::is_constant_evaluated()) {
+            for (; first != last; ++first, ++out) {
+                std::construct_at(out, *first);
+            }
+        } else {
+            std::uninitialized_copy(first, last, out);
+        }
+    }
+
+    template<typename InputIt, typename T>
+    constexpr void UninitializedCopyN(InputIt first, size_t count, T *out) {
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i != count; ++i, ++first) {
+                std::construct_at(out + i, *first);
+            }
+        } else {
+            std::uninitialized_copy_n(first, count, out);
+        }
+    }
+
+    template<typename T>
+    constexpr void UninitializedMoveN(T *first, size_t count, T *out) {
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i != count; ++i) {
+                std::construct_at(out + i, std::move(first[i]));
+            }
+        } else {
+            std::uninitialized_move_n(first, count, out);
+        }
+    }
+
+    template<typename T>
+    constexpr void UninitializedFillN(T *first, size_t count, const T &value) {
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i != count; ++i) {
+                std::construct_at(first + i, value);
+            }
+        } else {
+            std::uninitialized_fill_n(first, count, value);
+        }
+    }
+
+} // namespace detail
+
+template<typename T, typename Allocator = DefaultAllocator<T>,
+        typename GrowthPolicy = DoublingGrowth,
+        ExceptionPolicy Policy = ExceptionPolicy::Strong>
 class Vector {
 public:
-    Vector() = default;
+    constexpr Vector() = default;
 
-    explicit Vector(size_t size) : data_(size), size_(size) {
-        std::uninitialized_value_construct_n(data_.GetAddress(), size);
+    constexpr explicit Vector(Allocator alloc) : data_(std::move(alloc)) {}
+
+    constexpr explicit Vector(size_t size, Allocator alloc = Allocator())
+            : data_(size, std::move(alloc)), size_(size) {
+        detail::UninitializedValueConstructN(data_.GetAddress(), size);
     }
 
-    ~Vector() { std::destroy_n(data_.GetAddress(), size_); }
+    // Конструирует вектор из диапазона [first, last). Для forward-итераторов
+    // длина известна заранее, поэтому буфер выделяется ровно один раз точно
+    // по размеру — без поэлементных проверок ёмкости и слабины от удвоения.
+    // Однопроходные итераторы дозаписываются через AppendRange с обычным
+    // ростом
+    template<typename InputIt>
+        requires std::input_iterator<InputIt>
+    constexpr Vector(InputIt first, InputIt last, Allocator alloc = Allocator())
+            : data_(std::move(alloc)) {
+        if constexpr (IS_FORWARD_ITERATOR<InputIt>) {
+            size_t count = static_cast<size_t>(std::distance(first, last));
+            data_ = RawMemory<T, Allocator>(count, data_.GetAllocator());
+            detail::UninitializedCopy(first, last, data_.GetAddress());
+            size_ = count;
+        } else {
+            AppendRange(first, last);
+        }
+    }
 
-    Vector(const Vector &other) : data_(other.size_), size_(other.size_) {
-        std::uninitialized_copy_n(other.data_.GetAddress(), other.size_,
-                                  data_.GetAddress());
+    constexpr Vector(std::initializer_list<T> values, Allocator alloc = Allocator())
+            : Vector(values.begin(), values.end(), std::move(alloc)) {}
+
+    constexpr ~Vector() { std::destroy_n(data_.GetAddress(), size_); }
+
+    constexpr Vector(const Vector &other)
+            : data_(other.size_, other.data_.GetAllocator()), size_(other.size_) {
+        detail::UninitializedCopyN(other.data_.GetAddress(), other.size_,
+                                   data_.GetAddress());
     }
 
-    Vector(Vector &&other) noexcept { Swap(other); }
+    constexpr Vector(Vector &&other) noexcept { Swap(other); }
 
-    Vector &operator=(const Vector &rhs) {
+    constexpr Vector &operator=(const Vector &rhs) {
         if (this != &rhs) {
             if (rhs.size_ > data_.Capacity()) {
                 Vector rhs_copy(rhs);
@@ -102,8 +379,8 @@ public:
                 if (rhs.size_ >= size_) {
                     std::copy_n(rhs.data_.GetAddress(), size_, data_.GetAddress());
                     size_t offset = rhs.size_ - size_;
-                    std::uninitialized_copy_n(rhs.data_.GetAddress() + size_, offset,
-                                              data_.GetAddress() + size_);
+                    detail::UninitializedCopyN(rhs.data_.GetAddress() + size_,
+                                               offset, data_.GetAddress() + size_);
                 } else {
                     std::copy_n(rhs.data_.GetAddress(), rhs.size_, data_.GetAddress());
                     size_t offset = size_ - rhs.size_;
@@ -115,84 +392,393 @@ public:
         return *this;
     }
 
-    Vector &operator=(Vector &&rhs) noexcept {
+    constexpr Vector &operator=(Vector &&rhs) noexcept {
         if (this != &rhs) {
             Swap(rhs);
         }
         return *this;
     }
 
-    void Swap(Vector &other) noexcept {
+    constexpr void Swap(Vector &other) noexcept {
         std::swap(data_, other.data_);
         std::swap(size_, other.size_);
     }
 
-    void Reserve(size_t new_capacity) {
+    constexpr void Reserve(size_t new_capacity) {
         if (new_capacity <= data_.Capacity()) {
             return;
         }
-        MoveOrCopyDataAndReplace(RawMemory<T>(new_capacity));
+        MoveOrCopyDataAndReplace(NewBuffer(new_capacity));
     }
 
-    void Resize(size_t new_size) {
+    // Реаллоцирует буфер ровно под new_capacity элементов (но не меньше
+    // текущего размера) — в отличие от Reserve умеет и ужимать ёмкость
+    constexpr void ReserveExact(size_t new_capacity) {
+        new_capacity = std::max(new_capacity, size_);
+        if (new_capacity == data_.Capacity()) {
+            return;
+        }
+        MoveOrCopyDataAndReplace(NewBuffer(new_capacity));
+    }
+
+    // Возвращает неиспользуемую ёмкость аллокатору
+    constexpr void ShrinkToFit() { ReserveExact(size_); }
+
+    constexpr void Resize(size_t new_size) {
         if (new_size <= size_) {
             size_t offset = size_ - new_size;
             std::destroy_n(data_.GetAddress() + new_size, offset);
         } else {
             Reserve(new_size);
             size_t offset = new_size - size_;
-            std::uninitialized_value_construct_n(data_.GetAddress() + size_, offset);
+            detail::UninitializedValueConstructN(data_.GetAddress() + size_, offset);
         }
         size_ = new_size;
     }
 
-    void PushBack(const T &value) { EmplaceBack(value); }
+    // Результат Release: буфер со всё ещё живыми элементами, владение —
+    // у вызывающего
+    struct ReleasedBuffer {
+        T *data;
+        size_t size;
+        size_t capacity;
+    };
 
-    void PushBack(T &&value) { EmplaceBack(std::move(value)); }
+    // Оборачивает вектор вокруг уже существующей памяти (DMA-буфер, mmap и
+    // т.п.) без копирования: в буфере лежат size готовых элементов при
+    // ёмкости capacity, освобождать его будет переданный аллокатор
+    static Vector Adopt(T *buffer, size_t size, size_t capacity,
+                        Allocator alloc) {
+        assert(size <= capacity);
+        Vector result(std::move(alloc));
+        result.data_.AdoptBuffer(buffer, capacity);
+        result.size_ = size;
+        return result;
+    }
+
+    // Обратная операция: отдаёт буфер вместе с живыми элементами, вектор
+    // становится пустым. Разрушение элементов и освобождение памяти —
+    // забота вызывающего
+    ReleasedBuffer Release() noexcept {
+        ReleasedBuffer released{data_.GetAddress(), size_, data_.Capacity()};
+        data_.ReleaseBuffer();
+        size_ = 0;
+        return released;
+    }
+
+    // Конструирует вектор из size элементов, разбивая буфер на непрерывные
+    // куски и конструируя каждый своим потоком. Выгодно для очень больших
+    // векторов нетривиальных типов, где однопоточное заполнение занимает
+    // секунды
+    static Vector CreateParallel(size_t size, size_t num_threads,
+                                 Allocator alloc = Allocator()) {
+        Vector result(std::move(alloc));
+        result.data_ = RawMemory<T, Allocator>(size, result.data_.GetAllocator());
+        ParallelOverRanges(
+                result.data_.GetAddress(), size, num_threads,
+                [](T *first, size_t count) {
+                    std::uninitialized_value_construct_n(first, count);
+                });
+        result.size_ = size;
+        return result;
+    }
+
+    // Параллельный аналог Resize: хвост конструируется (или разрушается)
+    // несколькими потоками
+    void ResizeParallel(size_t new_size, size_t num_threads) {
+        if (new_size <= size_) {
+            ParallelOverRanges(data_.GetAddress() + new_size, size_ - new_size,
+                               num_threads, [](T *first, size_t count) {
+                        std::destroy_n(first, count);
+                    });
+        } else {
+            Reserve(new_size);
+            ParallelOverRanges(data_.GetAddress() + size_, new_size - size_,
+                               num_threads, [](T *first, size_t count) {
+                        std::uninitialized_value_construct_n(first, count);
+                    });
+        }
+        size_ = new_size;
+    }
+
+    // Глубокая копия, выполняемая несколькими потоками
+    Vector CopyParallel(size_t num_threads) const {
+        Vector result(data_.GetAllocator());
+        result.data_ = RawMemory<T, Allocator>(size_, result.data_.GetAllocator());
+        const T *src = data_.GetAddress();
+        T *dst = result.data_.GetAddress();
+        ParallelOverRanges(dst, size_, num_threads,
+                           [src, dst](T *first, size_t count) {
+                               std::uninitialized_copy_n(src + (first - dst),
+                                                         count, first);
+                           });
+        result.size_ = size_;
+        return result;
+    }
+
+    // Меняет размер, не инициализируя новые элементы вовсе — для буферов,
+    // которые тут же будут перезаписаны (recv, чтение из файла и т.п.).
+    // Только для типов, у которых «неинициализированный» объект корректен
+    void ResizeUninitialized(size_t new_size) {
+        static_assert(std::is_trivially_default_constructible_v<T> &&
+                              std::is_trivially_destructible_v<T>,
+                      "ResizeUninitialized требует тривиальный тип");
+        Reserve(new_size);
+        size_ = new_size;
+    }
+
+    // Как Resize, но новые элементы default-инициализируются: для
+    // арифметических типов это «без записи», для классов — обычный
+    // конструктор по умолчанию
+    void ResizeDefaultInit(size_t new_size) {
+        if (new_size <= size_) {
+            std::destroy_n(data_.GetAddress() + new_size, size_ - new_size);
+        } else {
+            Reserve(new_size);
+            std::uninitialized_default_construct_n(data_.GetAddress() + size_,
+                                                   new_size - size_);
+        }
+        size_ = new_size;
+    }
+
+    // В духе std::string::resize_and_overwrite: выдаёт op сырой буфер на
+    // new_size элементов, итоговым размером становится возвращённое op
+    // значение (не больше new_size)
+    template<typename Operation>
+    void ResizeAndOverwrite(size_t new_size, Operation op) {
+        static_assert(std::is_trivially_default_constructible_v<T> &&
+                              std::is_trivially_destructible_v<T>,
+                      "ResizeAndOverwrite требует тривиальный тип");
+        Reserve(new_size);
+        size_t used = op(data_.GetAddress(), new_size);
+        assert(used <= new_size);
+        size_ = used;
+    }
+
+    constexpr void PushBack(const T &value) { EmplaceBack(value); }
+
+    constexpr void PushBack(T &&value) { EmplaceBack(std::move(value)); }
 
     template<typename... Args>
-    T &EmplaceBack(Args &&...args) {
+    constexpr T &EmplaceBack(Args &&...args) {
         if (size_ == Capacity()) {
-            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
+            size_t new_capacity = GrowthPolicy::NextCapacity(Capacity());
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                if (!std::is_constant_evaluated()) {
+                    // Сначала материализуем значение: args могут ссылаться на
+                    // элементы самого вектора, которые realloc вправе перенести
+                    T value(std::forward<Args>(args)...);
+                    if (data_.TryExtend(new_capacity)) {
+                        // Блок расширен на месте, элементы не переносились
+                        NoteReallocation(size_, new_capacity, 0);
+                    } else {
+                        MoveOrCopyDataAndReplace(NewBuffer(new_capacity));
+                    }
+                    std::construct_at(data_ + size_, std::move(value));
+                    return *(data_ + size_++);
+                }
+            }
+            RawMemory<T, Allocator> new_data = NewBuffer(new_capacity);
 
-            new(new_data + size_) T(std::forward<Args>(args)...);
+            std::construct_at(new_data + size_, std::forward<Args>(args)...);
             MoveOrCopyDataAndReplace(std::move(new_data));
         } else {
-            new(data_ + size_) T(std::forward<Args>(args)...);
+            std::construct_at(data_ + size_, std::forward<Args>(args)...);
         }
         return *(data_ + size_++);
     }
 
-    void PopBack() noexcept {
+    // Дописывает группу элементов — по одному на аргумент — за одну
+    // проверку ёмкости и максимум одну реаллокацию; три подряд EmplaceBack
+    // проверяют ёмкость трижды и могут переносить буфер до трёх раз.
+    // Элементу с многоаргументным конструктором передаётся готовое T(...)
+    template<typename... Args>
+    constexpr void EmplaceBackN(Args &&...args) {
+        constexpr size_t COUNT = sizeof...(Args);
+        if (size_ + COUNT > Capacity()) {
+            // Группа строится в новом буфере до переноса, поэтому аргументы,
+            // ссылающиеся на элементы вектора, остаются валидными
+            RawMemory<T, Allocator> new_data = NewBuffer(std::max(
+                    size_ + COUNT, GrowthPolicy::NextCapacity(Capacity())));
+            ConstructGroup(new_data + size_, std::forward<Args>(args)...);
+            MoveOrCopyDataAndReplace(std::move(new_data));
+        } else {
+            ConstructGroup(data_ + size_, std::forward<Args>(args)...);
+        }
+        size_ += COUNT;
+    }
+
+    template<typename... Args>
+    constexpr void PushBackN(Args &&...args) {
+        EmplaceBackN(std::forward<Args>(args)...);
+    }
+
+    constexpr void PopBack() noexcept {
         assert(size_ > 0);
         std::destroy_n(data_.GetAddress() + --size_, 1);
     }
 
+    // Дописывает диапазон в конец за одну проверку ёмкости и максимум одну
+    // реаллокацию. Для входных итераторов без известной длины — поэлементный
+    // откат к EmplaceBack
+    template<typename InputIt>
+    constexpr void AppendRange(InputIt first, InputIt last) {
+        if constexpr (IS_FORWARD_ITERATOR<InputIt>) {
+            size_t count = static_cast<size_t>(std::distance(first, last));
+            if (size_ + count > Capacity()) {
+                // Растём сразу до итогового размера, но не медленнее, чем
+                // велит политика, чтобы серия AppendRange оставалась
+                // амортизированно линейной
+                Reserve(std::max(size_ + count,
+                                 GrowthPolicy::NextCapacity(Capacity())));
+            }
+            detail::UninitializedCopy(first, last, data_.GetAddress() + size_);
+            size_ += count;
+        } else {
+            for (; first != last; ++first) {
+                EmplaceBack(*first);
+            }
+        }
+    }
+
+    // Переносит содержимое other в конец. Пустой получатель забирает буфер
+    // источника целиком — обмен RawMemory без единого переноса элементов;
+    // иначе элементы переезжают одним массовым проходом. other остаётся в
+    // валидном, но неопределённом состоянии
+    constexpr void Append(Vector &&other) {
+        assert(this != &other);
+        if (size_ == 0) {
+            Swap(other);
+            return;
+        }
+        AppendRange(std::make_move_iterator(other.begin()),
+                    std::make_move_iterator(other.end()));
+    }
+
+    // Заменяет содержимое элементами диапазона, переиспользуя буфер и уже
+    // сконструированные элементы, как operator=
+    template<typename InputIt>
+    constexpr void Assign(InputIt first, InputIt last) {
+        if constexpr (IS_FORWARD_ITERATOR<InputIt>) {
+            size_t count = static_cast<size_t>(std::distance(first, last));
+            if (count > Capacity()) {
+                RawMemory<T, Allocator> new_data = NewBuffer(count);
+                detail::UninitializedCopy(first, last, new_data.GetAddress());
+                std::destroy_n(data_.GetAddress(), size_);
+                data_.Swap(new_data);
+            } else if (count >= size_) {
+                InputIt middle = std::next(first, size_);
+                std::copy(first, middle, data_.GetAddress());
+                detail::UninitializedCopy(middle, last, data_.GetAddress() + size_);
+            } else {
+                std::copy(first, last, data_.GetAddress());
+                std::destroy_n(data_.GetAddress() + count, size_ - count);
+            }
+            size_ = count;
+        } else {
+            Resize(0);
+            AppendRange(first, last);
+        }
+    }
+
     using iterator = T *;
     using const_iterator = const T *;
 
-    iterator begin() noexcept { return data_.GetAddress(); }
+    constexpr iterator begin() noexcept { return data_.GetAddress(); }
 
-    iterator end() noexcept { return data_.GetAddress() + size_; }
+    constexpr iterator end() noexcept { return data_.GetAddress() + size_; }
 
-    const_iterator begin() const noexcept { return data_.GetAddress(); }
+    constexpr const_iterator begin() const noexcept { return data_.GetAddress(); }
 
-    const_iterator end() const noexcept { return data_.GetAddress() + size_; }
+    constexpr const_iterator end() const noexcept { return data_.GetAddress() + size_; }
 
-    const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
 
-    const_iterator cend() const noexcept { return end(); }
+    constexpr const_iterator cend() const noexcept { return end(); }
 
-    iterator Insert(const_iterator pos, const T &value) {
+    constexpr iterator Insert(const_iterator pos, const T &value) {
         return Emplace(pos, value);
     }
 
-    iterator Insert(const_iterator pos, T &&value) {
+    constexpr iterator Insert(const_iterator pos, T &&value) {
         return Emplace(pos, std::move(value));
     }
 
+    // Вставляет count копий value перед pos, раздвигая хвост один раз:
+    // O(n + count) вместо O(count * n) у серии одиночных Insert
+    constexpr iterator Insert(const_iterator pos, size_t count, const T &value) {
+        assert(pos >= begin() && pos <= end());
+        size_t index = std::distance(cbegin(), pos);
+        if (count == 0) {
+            return begin() + index;
+        }
+        if (size_ + count > Capacity()) {
+            RawMemory<T, Allocator> new_data = NewBuffer(std::max(
+                    size_ + count, GrowthPolicy::NextCapacity(Capacity())));
+            detail::UninitializedFillN(new_data + index, count, value);
+            MoveOrCopyDataByPartAndReplace(std::move(new_data), index, count);
+        } else {
+            // value может указывать внутрь сдвигаемого хвоста
+            T value_copy(value);
+            size_t alive = OpenGap(index, count);
+            std::fill_n(begin() + index, alive, value_copy);
+            detail::UninitializedFillN(begin() + index + alive, count - alive,
+                                       value_copy);
+        }
+        size_ += count;
+        return begin() + index;
+    }
+
+    // Вставляет диапазон [first, last) перед pos за один сдвиг хвоста.
+    // Итераторы не должны указывать в сам вектор. Для однопроходных
+    // итераторов без известной длины — дозапись в конец плюс rotate
+    template<typename InputIt>
+        requires std::input_iterator<InputIt>
+    constexpr iterator Insert(const_iterator pos, InputIt first, InputIt last) {
+        assert(pos >= begin() && pos <= end());
+        size_t index = std::distance(cbegin(), pos);
+        if constexpr (IS_FORWARD_ITERATOR<InputIt>) {
+            size_t count = static_cast<size_t>(std::distance(first, last));
+            if (count == 0) {
+                return begin() + index;
+            }
+            if (size_ + count > Capacity()) {
+                RawMemory<T, Allocator> new_data = NewBuffer(std::max(
+                        size_ + count, GrowthPolicy::NextCapacity(Capacity())));
+                detail::UninitializedCopy(first, last, new_data + index);
+                MoveOrCopyDataByPartAndReplace(std::move(new_data), index, count);
+            } else {
+                size_t alive = OpenGap(index, count);
+                InputIt middle = std::next(first, alive);
+                std::copy(first, middle, begin() + index);
+                detail::UninitializedCopy(middle, last, begin() + index + alive);
+            }
+            size_ += count;
+        } else {
+            size_t old_size = size_;
+            for (; first != last; ++first) {
+                EmplaceBack(*first);
+            }
+            std::rotate(begin() + index, begin() + old_size, end());
+        }
+        return begin() + index;
+    }
+
+    // Вставляет содержимое other перед pos. Пустой получатель забирает
+    // буфер источника, как Append; иначе хвост раздвигается один раз и
+    // элементы переносятся массово
+    constexpr iterator Insert(const_iterator pos, Vector &&other) {
+        assert(this != &other);
+        if (size_ == 0) {
+            Swap(other);
+            return begin();
+        }
+        return Insert(pos, std::make_move_iterator(other.begin()),
+                      std::make_move_iterator(other.end()));
+    }
+
     template<typename... Args>
-    iterator Emplace(const_iterator pos, Args &&...args) {
+    constexpr iterator Emplace(const_iterator pos, Args &&...args) {
         assert(pos >= begin() && pos <= end());
         if (pos == cend()) {
             return &EmplaceBack(std::forward<Args>(args)...);
@@ -200,13 +786,14 @@ public:
 
         size_t count = std::distance(cbegin(), pos);
         if (size_ == Capacity()) {
-            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
+            RawMemory<T, Allocator> new_data =
+                    NewBuffer(GrowthPolicy::NextCapacity(Capacity()));
 
-            new(new_data + count) T(std::forward<Args>(args)...);
+            std::construct_at(new_data + count, std::forward<Args>(args)...);
 
-            MoveOrCopyDataByPartAndReplace(std::move(new_data), count);
+            MoveOrCopyDataByPartAndReplace(std::move(new_data), count, 1);
         } else {
-            new(end()) T(std::forward<T>(*(end() - 1)));
+            std::construct_at(end(), std::move(*(end() - 1)));
             std::move_backward(begin() + count, end() - 1, end());
             *(begin() + count) = T(std::forward<Args>(args)...);
         }
@@ -214,7 +801,7 @@ public:
         return begin() + count;
     }
 
-    iterator Erase(const_iterator pos) {
+    constexpr iterator Erase(const_iterator pos) {
         assert(pos >= begin() && pos < end());
         size_t count = std::distance(pos, cend());
         std::move(end() - count + 1, end(), end() - count);
@@ -222,44 +809,335 @@ public:
         return end() - count + 1;
     }
 
-    size_t Size() const noexcept { return size_; }
+    // Удаляет диапазон [first, last) одним сдвигом хвоста вместо
+    // поэлементных вызовов Erase
+    constexpr iterator Erase(const_iterator first, const_iterator last) {
+        assert(first >= begin() && last <= end() && first <= last);
+        size_t start = std::distance(cbegin(), first);
+        size_t count = std::distance(first, last);
+        if (count != 0) {
+            std::move(begin() + start + count, end(), begin() + start);
+            std::destroy_n(begin() + (size_ - count), count);
+            size_ -= count;
+        }
+        return begin() + start;
+    }
 
-    size_t Capacity() const noexcept { return data_.Capacity(); }
+    // Remove-erase одним проходом; возвращает число удалённых элементов
+    template<typename Predicate>
+    constexpr size_t EraseIf(Predicate pred) {
+        iterator new_end = std::remove_if(begin(), end(), pred);
+        size_t removed = static_cast<size_t>(std::distance(new_end, end()));
+        std::destroy_n(new_end, removed);
+        size_ -= removed;
+        return removed;
+    }
 
-    const T &operator[](size_t index) const noexcept {
+    // O(1)-удаление без сохранения порядка: на место pos переезжает
+    // последний элемент
+    constexpr iterator EraseSwapLast(const_iterator pos) {
+        assert(pos >= begin() && pos < end());
+        iterator target = begin() + std::distance(cbegin(), pos);
+        if (target != end() - 1) {
+            *target = std::move(*(end() - 1));
+        }
+        PopBack();
+        return target;
+    }
+
+    constexpr size_t Size() const noexcept { return size_; }
+
+    constexpr size_t Capacity() const noexcept { return data_.Capacity(); }
+
+    constexpr const T &operator[](size_t index) const noexcept {
         return const_cast<Vector &>(*this)[index];
     }
 
-    T &operator[](size_t index) noexcept {
+    constexpr T &operator[](size_t index) noexcept {
+#ifdef ADVANCED_VECTOR_CHECKED_INDEX
+        // Аудит-режим: вся индексация ходит через проверку At()
+        return At(index);
+#else
         assert(index < size_);
         return data_[index];
+#endif
+    }
+
+    // Доступ с проверкой границ, не исчезающей в NDEBUG-сборках: выход за
+    // границы — немедленный trap. Исключения здесь не вариант по цене, а
+    // предсказуемая [[unlikely]]-ветка стоит порядка такта; повреждённый
+    // индекс останавливает процесс, не уезжая дальше по программе.
+    // Определение ADVANCED_VECTOR_CHECKED_INDEX до включения заголовка
+    // маршрутизирует через эту проверку и operator[]
+    constexpr const T &At(size_t index) const noexcept {
+        return const_cast<Vector &>(*this).At(index);
+    }
+
+    constexpr T &At(size_t index) noexcept {
+        if (index >= size_) [[unlikely]] {
+            __builtin_trap();
+        }
+        return data_[index];
     }
 
 private:
-    void MoveOrCopyDataAndReplace(RawMemory<T> &&new_data) {
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
+    // Многопоточная дозапись конструирует элементы прямо в буфере за size_
+    // и публикует итоговый размер по завершении
+    template<typename U, typename UAllocator, typename UGrowthPolicy,
+            ExceptionPolicy UPolicy>
+    friend class ConcurrentAppender;
+
+    // Создаёт новый сырой буфер тем же аллокатором, что и текущий
+    constexpr RawMemory<T, Allocator> NewBuffer(size_t capacity) {
+        return RawMemory<T, Allocator>(capacity, data_.GetAllocator());
+    }
+
+    // Делит диапазон [base, base + count) на куски по числу потоков и
+    // выполняет work над каждым. Кусок, чья work бросила исключение,
+    // прибирается самой work (гарантия uninitialized_*), успешные куски
+    // разрушаются здесь, после чего первое исключение летит дальше
+    template<typename Work>
+    static void ParallelOverRanges(T *base, size_t count, size_t num_threads,
+                                   Work work) {
+        num_threads = std::clamp<size_t>(num_threads, 1, std::max<size_t>(count, 1));
+        if (num_threads == 1 || count == 0) {
+            work(base, count);
+            return;
+        }
+        size_t chunk = (count + num_threads - 1) / num_threads;
+        Vector<std::exception_ptr> errors(num_threads);
+        Vector<std::thread> workers;
+        workers.Reserve(num_threads);
+        for (size_t i = 0; i < num_threads; ++i) {
+            size_t start = std::min(i * chunk, count);
+            size_t len = std::min(chunk, count - start);
+            workers.EmplaceBack([&, start, len, i] {
+                try {
+                    work(base + start, len);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        for (size_t i = 0; i < workers.Size(); ++i) {
+            workers[i].join();
+        }
+        for (size_t i = 0; i < num_threads; ++i) {
+            if (errors[i] != nullptr) {
+                for (size_t j = 0; j < num_threads; ++j) {
+                    if (errors[j] == nullptr) {
+                        size_t start = std::min(j * chunk, count);
+                        std::destroy_n(base + start, std::min(chunk, count - start));
+                    }
+                }
+                std::rethrow_exception(errors[i]);
+            }
+        }
+    }
+
+    // true, если при реаллокации элементы переносятся move-конструктором.
+    // Strong требует noexcept-move (или отсутствия копирующего конструктора),
+    // Terminate перемещает безусловно
+    static constexpr bool MOVE_ON_REALLOCATION =
+            Policy == ExceptionPolicy::Terminate ||
+            std::is_nothrow_move_constructible_v<T> ||
+            !std::is_copy_constructible_v<T>;
+
+    // Перенос диапазона move-конструкторами. noexcept в режиме Terminate:
+    // исключение из move здесь — это std::terminate, а не откат
+    static constexpr void MoveRange(T *from, size_t count, T *to) noexcept(
+            Policy == ExceptionPolicy::Terminate ||
+            std::is_nothrow_move_constructible_v<T>) {
+        detail::UninitializedMoveN(from, count, to);
+    }
+
+    // Конструирует по элементу на аргумент; при исключении уже построенная
+    // часть группы разрушается, и исключение летит дальше
+    template<typename... Args>
+    static constexpr void ConstructGroup(T *out, Args &&...args) {
+        size_t constructed = 0;
+        try {
+            ((std::construct_at(out + constructed, std::forward<Args>(args)),
+              ++constructed),
+             ...);
+        } catch (...) {
+            std::destroy_n(out, constructed);
+            throw;
+        }
+    }
+
+    // Точка учёта роста буфера; пустышка без ADVANCED_VECTOR_STATS
+    constexpr void NoteReallocation([[maybe_unused]] size_t old_capacity,
+                                    [[maybe_unused]] size_t new_capacity,
+                                    [[maybe_unused]] size_t bytes_moved) const {
+#ifdef ADVANCED_VECTOR_STATS
+        if (std::is_constant_evaluated()) {
+            return;
+        }
+        VectorStats &stats = ThreadVectorStats();
+        ++stats.num_reallocations;
+        stats.bytes_moved += bytes_moved;
+        stats.peak_capacity_bytes =
+                std::max(stats.peak_capacity_bytes, new_capacity * sizeof(T));
+        stats.wasted_bytes += (new_capacity - size_) * sizeof(T);
+        if (ReallocationCallback callback = ReallocationCallbackRef()) {
+            callback(sizeof(T), old_capacity, new_capacity, size_);
+        }
+#endif
+    }
+
+    constexpr void MoveOrCopyDataAndReplace(RawMemory<T, Allocator> &&new_data) {
+        NoteReallocation(data_.Capacity(), new_data.Capacity(),
+                         size_ * sizeof(T));
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>) {
+            // Тривиально релоцируемые типы переносятся одним блочным
+            // копированием, без поэлементного конструирования и без прохода
+            // деструкторов по старому буферу. При константных вычислениях
+            // memcpy недоступен — ниже обычный поэлементный перенос
+            if (!std::is_constant_evaluated()) {
+                if (size_ != 0) {
+                    // void-касты глушат -Wclass-memaccess: для типов,
+                    // объявленных релоцируемыми, побайтовый перенос легален
+                    std::memcpy(static_cast<void *>(new_data.GetAddress()),
+                                static_cast<const void *>(data_.GetAddress()),
+                                size_ * sizeof(T));
+                }
+                data_.Swap(new_data);
+                return;
+            }
+        }
+        if constexpr (MOVE_ON_REALLOCATION) {
+            MoveRange(data_.GetAddress(), size_, new_data.GetAddress());
         } else {
-            std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
+            detail::UninitializedCopyN(data_.GetAddress(), size_, new_data.GetAddress());
         }
 
         std::destroy_n(data_.GetAddress(), size_);
         data_.Swap(new_data);
     }
 
-    void MoveOrCopyDataByPartAndReplace(RawMemory<T> &&new_data, size_t count) {
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move(begin(), begin() + count, new_data.GetAddress());
-            std::uninitialized_move(begin() + count, end(), new_data.GetAddress() + count + 1);
+    // Переносит элементы в new_data, оставляя перед позицией index промежуток
+    // в gap слотов под уже сконструированные там новые элементы
+    constexpr void MoveOrCopyDataByPartAndReplace(RawMemory<T, Allocator> &&new_data,
+                                                  size_t index, size_t gap) {
+        NoteReallocation(data_.Capacity(), new_data.Capacity(),
+                         size_ * sizeof(T));
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>) {
+            if (!std::is_constant_evaluated()) {
+                if (index != 0) {
+                    std::memcpy(static_cast<void *>(new_data.GetAddress()),
+                                static_cast<const void *>(data_.GetAddress()),
+                                index * sizeof(T));
+                }
+                if (size_ != index) {
+                    std::memcpy(
+                            static_cast<void *>(new_data.GetAddress() + index + gap),
+                            static_cast<const void *>(data_.GetAddress() + index),
+                            (size_ - index) * sizeof(T));
+                }
+                data_.Swap(new_data);
+                return;
+            }
+        }
+        if constexpr (MOVE_ON_REALLOCATION) {
+            MoveRange(begin(), index, new_data.GetAddress());
+            MoveRange(begin() + index, size_ - index,
+                      new_data.GetAddress() + index + gap);
         } else {
-            std::uninitialized_copy(begin(), begin() + count, new_data.GetAddress());
-            std::uninitialized_copy(begin() + count, end(), new_data.GetAddress() + count + 1);
+            detail::UninitializedCopy(begin(), begin() + index, new_data.GetAddress());
+            detail::UninitializedCopy(begin() + index, end(), new_data.GetAddress() + index + gap);
         }
 
         std::destroy_n(data_.GetAddress(), size_);
         data_.Swap(new_data);
     }
 
-    RawMemory<T> data_;
+    // Раздвигает хвост [index, size_) на count позиций вправо одним сдвигом.
+    // Возвращает число живых (moved-from) элементов в начале промежутка:
+    // в них новые значения присваиваются, в остальные — конструируются
+    constexpr size_t OpenGap(size_t index, size_t count) {
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>) {
+            if (!std::is_constant_evaluated()) {
+                std::memmove(
+                        static_cast<void *>(data_.GetAddress() + index + count),
+                        static_cast<const void *>(data_.GetAddress() + index),
+                        (size_ - index) * sizeof(T));
+                return 0;
+            }
+        }
+        size_t tail = size_ - index;
+        if (count >= tail) {
+            detail::UninitializedMoveN(begin() + index, tail,
+                                       begin() + index + count);
+            return tail;
+        }
+        detail::UninitializedMoveN(end() - count, count, end());
+        std::move_backward(begin() + index, end() - count, end());
+        return count;
+    }
+
+    RawMemory<T, Allocator> data_;
     size_t size_ = 0;
-};
\ No newline at end of file
+};
+
+// Многопоточная дозапись в вектор без мьютекса: ёмкость резервируется
+// один раз в конструкторе, после чего продюсеры забирают слоты одним
+// fetch_add и конструируют элементы каждый в своём, не мешая друг другу.
+// Пока дозапись идёт, вектор нельзя трогать ничем другим; Finish()
+// вызывается в одном потоке после join всех продюсеров и публикует
+// итоговый размер. Конструктор T не должен бросать во время дозаписи —
+// иначе в буфере останется несконструированный слот ниже курсора
+template<typename T, typename Allocator = DefaultAllocator<T>,
+        typename GrowthPolicy = DoublingGrowth,
+        ExceptionPolicy Policy = ExceptionPolicy::Strong>
+class ConcurrentAppender {
+public:
+    using TargetVector = Vector<T, Allocator, GrowthPolicy, Policy>;
+
+    // Резервирует место под max_appends новых элементов; реаллокация,
+    // если она нужна, происходит здесь, в одном потоке
+    ConcurrentAppender(TargetVector &target, size_t max_appends)
+            : target_(&target), base_(target.Size()), limit_(max_appends) {
+        target.Reserve(base_ + max_appends);
+    }
+
+    ConcurrentAppender(const ConcurrentAppender &) = delete;
+
+    ConcurrentAppender &operator=(const ConcurrentAppender &) = delete;
+
+    // Лок-фри: слот достаётся одним fetch_add, конструирование идёт в
+    // непересекающихся участках буфера
+    template<typename... Args>
+    T &EmplaceBack(Args &&...args) {
+        size_t slot = cursor_.fetch_add(1, std::memory_order_relaxed);
+        assert(slot < limit_);
+        T *ptr = target_->data_ + (base_ + slot);
+        std::construct_at(ptr, std::forward<Args>(args)...);
+        return *ptr;
+    }
+
+    void PushBack(const T &value) { EmplaceBack(value); }
+
+    void PushBack(T &&value) { EmplaceBack(std::move(value)); }
+
+    // Публикует дозаписанные элементы; вызывать строго после завершения
+    // (join) всех продюсеров. Возвращает число добавленных элементов
+    size_t Finish() noexcept {
+        size_t appended = cursor_.load(std::memory_order_acquire);
+        target_->size_ = base_ + appended;
+        return appended;
+    }
+
+private:
+    TargetVector *target_;
+    size_t base_;
+    size_t limit_;
+    std::atomic<size_t> cursor_{0};
+};
+
+// Vector в режиме ExceptionPolicy::Terminate: реаллокации всегда
+// перемещают, глубоких копий ради строгой гарантии нет
+template<typename T, typename Allocator = DefaultAllocator<T>,
+        typename GrowthPolicy = DoublingGrowth>
+using TerminatingVector =
+        Vector<T, Allocator, GrowthPolicy, ExceptionPolicy::Terminate>;
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "vector.h"
+
+// Сканы по непрерывному буферу Vector для арифметических T. Обход через
+// begin()/end() из другой единицы трансляции компилятор векторизует не
+// всегда; здесь ядра написаны так, чтобы автовекторизация срабатывала
+// гарантированно и на полную ширину регистра: поиск идёт блоками без
+// раннего выхода внутри блока, суммирование — независимыми
+// аккумуляторами (изменение порядка сложения для float осознанное),
+// подсчёт — накоплением флагов без ветвлений. При сборке с -mavx2,
+// -mavx512f или -mcpu=+sve те же ядра разворачиваются в соответствующие
+// инструкции — intrinsics и ручной диспатч не нужны
+
+// Заполняет вектор значением одним линейным проходом
+template<typename T, typename Allocator, typename GrowthPolicy,
+        ExceptionPolicy Policy>
+void Fill(Vector<T, Allocator, GrowthPolicy, Policy> &v, T value) {
+    static_assert(std::is_arithmetic_v<T>);
+    T *data = v.begin();
+    size_t size = v.Size();
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = value;
+    }
+}
+
+// Первое вхождение value; end(), если его нет. Ветвление — один раз на
+// блок: внутренняя свёртка по блоку векторизуется целиком
+template<typename T, typename Allocator, typename GrowthPolicy,
+        ExceptionPolicy Policy>
+const T *Find(const Vector<T, Allocator, GrowthPolicy, Policy> &v, T value) {
+    static_assert(std::is_arithmetic_v<T>);
+    constexpr size_t BLOCK = 256 / sizeof(T);
+    const T *data = v.begin();
+    size_t size = v.Size();
+    size_t i = 0;
+    for (; i + BLOCK <= size; i += BLOCK) {
+        unsigned any = 0;
+        for (size_t j = 0; j < BLOCK; ++j) {
+            any |= static_cast<unsigned>(data[i + j] == value);
+        }
+        if (any != 0) {
+            break;
+        }
+    }
+    for (; i < size; ++i) {
+        if (data[i] == value) {
+            return data + i;
+        }
+    }
+    return data + size;
+}
+
+// Минимум за два прохода: векторизуемая min-свёртка значения, затем поиск
+// его первой позиции. Для float с NaN, как и у std::min_element,
+// результат не определён
+template<typename T, typename Allocator, typename GrowthPolicy,
+        ExceptionPolicy Policy>
+const T *MinElement(const Vector<T, Allocator, GrowthPolicy, Policy> &v) {
+    static_assert(std::is_arithmetic_v<T>);
+    const T *data = v.begin();
+    size_t size = v.Size();
+    if (size == 0) {
+        return v.end();
+    }
+    T best = data[0];
+    for (size_t i = 1; i < size; ++i) {
+        best = data[i] < best ? data[i] : best;
+    }
+    return Find(v, best);
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy,
+        ExceptionPolicy Policy>
+const T *MaxElement(const Vector<T, Allocator, GrowthPolicy, Policy> &v) {
+    static_assert(std::is_arithmetic_v<T>);
+    const T *data = v.begin();
+    size_t size = v.Size();
+    if (size == 0) {
+        return v.end();
+    }
+    T best = data[0];
+    for (size_t i = 1; i < size; ++i) {
+        best = data[i] > best ? data[i] : best;
+    }
+    return Find(v, best);
+}
+
+// Сумма четырьмя независимыми аккумуляторами: строгий порядок сложения
+// float запрещает компилятору векторизовать наивный цикл без -ffast-math,
+// поэтому переассоциация выполнена явно
+template<typename T, typename Allocator, typename GrowthPolicy,
+        ExceptionPolicy Policy>
+T Sum(const Vector<T, Allocator, GrowthPolicy, Policy> &v) {
+    static_assert(std::is_arithmetic_v<T>);
+    const T *data = v.begin();
+    size_t size = v.Size();
+    T acc0{}, acc1{}, acc2{}, acc3{};
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        acc0 += data[i];
+        acc1 += data[i + 1];
+        acc2 += data[i + 2];
+        acc3 += data[i + 3];
+    }
+    T total = (acc0 + acc2) + (acc1 + acc3);
+    for (; i < size; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+// Подсчёт без ветвлений: флаг предиката накапливается как целое, что
+// для простых предикатов сводится к векторному сравнению и сложению
+template<typename T, typename Allocator, typename GrowthPolicy,
+        ExceptionPolicy Policy, typename Predicate>
+size_t CountIf(const Vector<T, Allocator, GrowthPolicy, Policy> &v,
+               Predicate pred) {
+    static_assert(std::is_arithmetic_v<T>);
+    const T *data = v.begin();
+    size_t size = v.Size();
+    size_t count = 0;
+    for (size_t i = 0; i < size; ++i) {
+        count += static_cast<size_t>(pred(data[i]) ? 1 : 0);
+    }
+    return count;
+}